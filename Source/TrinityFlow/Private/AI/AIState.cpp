@@ -13,7 +13,9 @@ void UAIState::Enter(AEnemyBase* Enemy, AEnemyAIController* AIController)
 	CachedEnemy = Enemy;
 	CachedAIController = AIController;
 	
-	if (Enemy)
+	// Pooled states are owned by their state machine
+	CachedStateMachine = GetTypedOuter<UAIStateMachine>();
+	if (!CachedStateMachine && Enemy)
 	{
 		CachedStateMachine = Enemy->FindComponentByClass<UAIStateMachine>();
 	}
@@ -26,6 +28,24 @@ void UAIState::Update(float DeltaTime)
 	// Override in derived classes
 }
 
+void UAIState::Evaluate(const FAIStateSnapshot& Snapshot, FAIStateDecision& OutDecision)
+{
+	OutDecision.bRunUpdate = true;
+}
+
+void UAIState::Apply(const FAIStateSnapshot& Snapshot, const FAIStateDecision& Decision)
+{
+	if (Decision.bRunUpdate)
+	{
+		Update(Snapshot.DeltaTime);
+	}
+
+	if (Decision.NextState)
+	{
+		TransitionToState(Decision.NextState);
+	}
+}
+
 void UAIState::Exit()
 {
 	UE_LOG(LogTemp, Log, TEXT("AI State: Exiting %s"), *StateName);
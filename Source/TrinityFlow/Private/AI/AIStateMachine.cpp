@@ -2,16 +2,29 @@
 #include "AI/AIState.h"
 #include "Enemy/EnemyBase.h"
 #include "AI/EnemyAIController.h"
+#include "AI/EnemyDecisionSubsystem.h"
+#include "AI/EnemyPerceptionSubsystem.h"
+#include "AI/FlowFieldSubsystem.h"
+#include "Core/CombatComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UnrealType.h"
+
+uint64 UAIStateMachine::TotalTransitions = 0;
+uint64 UAIStateMachine::TotalAllocationsAvoided = 0;
 
 UAIStateMachine::UAIStateMachine()
 {
 	PrimaryComponentTick.bCanEverTick = true;
+	DecisionSubsystem = nullptr;
 }
 
 void UAIStateMachine::BeginPlay()
 {
 	Super::BeginPlay();
 	
+	DecisionSubsystem = GetWorld()->GetSubsystem<UEnemyDecisionSubsystem>();
+
 	OwnerEnemy = Cast<AEnemyBase>(GetOwner());
 	if (OwnerEnemy)
 	{
@@ -31,12 +44,77 @@ void UAIStateMachine::TickComponent(float DeltaTime, ELevelTick TickType, FActor
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	if (CurrentState)
+	if (!CurrentState)
+	{
+		return;
+	}
+
+	if (DecisionSubsystem)
 	{
-		CurrentState->Update(DeltaTime);
+		DecisionSubsystem->Enqueue(this, DeltaTime);
+		return;
+	}
+
+	FAIStateSnapshot Snapshot;
+	if (GatherSnapshot(DeltaTime, Snapshot))
+	{
+		FAIStateDecision Decision;
+		CurrentState->Evaluate(Snapshot, Decision);
+		CurrentState->Apply(Snapshot, Decision);
 	}
 }
 
+bool UAIStateMachine::GatherSnapshot(float DeltaTime, FAIStateSnapshot& OutSnapshot)
+{
+	if (!CurrentState || !OwnerEnemy)
+	{
+		return false;
+	}
+
+	UWorld* World = GetWorld();
+
+	OutSnapshot.DeltaTime = DeltaTime;
+	OutSnapshot.Enemy = OwnerEnemy;
+	OutSnapshot.EnemyLocation = OwnerEnemy->GetActorLocation();
+	OutSnapshot.SightRange = OwnerEnemy->GetSightRange();
+	OutSnapshot.AttackRange = OwnerEnemy->GetAttackRange();
+
+	UCombatComponent* CombatComp = OwnerEnemy->GetCombatComponent();
+	OutSnapshot.bCanAttack = CombatComp && CombatComp->CanAttack();
+
+	OutSnapshot.Target = OwnerEnemy->GetTargetPlayer();
+	if (OutSnapshot.Target)
+	{
+		OutSnapshot.TargetLocation = OutSnapshot.Target->GetActorLocation();
+	}
+
+	OutSnapshot.Player = UGameplayStatics::GetPlayerPawn(World, 0);
+	if (OutSnapshot.Player)
+	{
+		OutSnapshot.PlayerLocation = OutSnapshot.Player->GetActorLocation();
+	}
+
+	// Only ask perception about the player once it is within sight range, so idle enemies far away
+	// do not keep line-of-sight traces alive
+	AActor* Observed = OutSnapshot.Target;
+	if (!Observed && OutSnapshot.Player
+		&& FVector::DistSquared(OutSnapshot.EnemyLocation, OutSnapshot.PlayerLocation) <= FMath::Square(OutSnapshot.SightRange))
+	{
+		Observed = OutSnapshot.Player;
+	}
+
+	if (Observed)
+	{
+		if (UEnemyPerceptionSubsystem* Perception = World->GetSubsystem<UEnemyPerceptionSubsystem>())
+		{
+			OutSnapshot.Visibility = Perception->GetVisibility(OwnerEnemy, Observed);
+		}
+	}
+
+	OutSnapshot.FlowField = World->GetSubsystem<UFlowFieldSubsystem>();
+	return true;
+}
+
 void UAIStateMachine::Initialize(TSubclassOf<UAIState> InitialStateClass)
 {
 	if (!InitialStateClass)
@@ -45,6 +123,7 @@ void UAIStateMachine::Initialize(TSubclassOf<UAIState> InitialStateClass)
 		return;
 	}
 
+	PrewarmStatePool(InitialStateClass);
 	CreateAndEnterState(InitialStateClass);
 }
 
@@ -78,11 +157,108 @@ void UAIStateMachine::CreateAndEnterState(TSubclassOf<UAIState> StateClass)
 		return;
 	}
 
+	bool bCreated = false;
 	CurrentStateClass = StateClass;
-	CurrentState = NewObject<UAIState>(this, StateClass);
+	CurrentState = FindOrCreatePooledState(StateClass, bCreated);
+
+	TotalTransitions++;
+	if (!bCreated)
+	{
+		TotalAllocationsAvoided++;
+	}
 	
 	if (CurrentState)
 	{
+		// Enter resets the per-visit fields of a reused instance
 		CurrentState->Enter(OwnerEnemy, OwnerAIController);
 	}
-}
\ No newline at end of file
+}
+
+TSubclassOf<UAIState> UAIStateMachine::FindStateClass(TSubclassOf<UAIState> BaseClass) const
+{
+	// The pool was prewarmed from the initial state's transitions, so it holds the configured classes
+	for (const UAIState* State : StatePool)
+	{
+		if (State && State->GetClass()->IsChildOf(BaseClass))
+		{
+			return State->GetClass();
+		}
+	}
+
+	return nullptr;
+}
+
+UAIState* UAIStateMachine::FindOrCreatePooledState(TSubclassOf<UAIState> StateClass, bool& bOutCreated)
+{
+	bOutCreated = false;
+
+	for (UAIState* State : StatePool)
+	{
+		if (State && State->GetClass() == StateClass)
+		{
+			return State;
+		}
+	}
+
+	UAIState* NewState = NewObject<UAIState>(this, StateClass);
+	StatePool.Add(NewState);
+	bOutCreated = true;
+	return NewState;
+}
+
+void UAIStateMachine::PrewarmStatePool(TSubclassOf<UAIState> StateClass)
+{
+	TArray<UClass*, TInlineAllocator<8>> PendingClasses;
+	PendingClasses.Add(StateClass);
+
+	while (PendingClasses.Num() > 0)
+	{
+		UClass* Class = PendingClasses.Pop(EAllowShrinking::No);
+
+		bool bCreated = false;
+		UAIState* State = FindOrCreatePooledState(Class, bCreated);
+		if (!bCreated)
+		{
+			continue;
+		}
+
+		// Follow the state's TSubclassOf<UAIState> transition properties (ChaseStateClass etc.)
+		for (TFieldIterator<FClassProperty> It(Class); It; ++It)
+		{
+			if (!It->MetaClass || !It->MetaClass->IsChildOf(UAIState::StaticClass()))
+			{
+				continue;
+			}
+
+			UClass* TargetClass = Cast<UClass>(It->GetObjectPropertyValue_InContainer(State));
+			if (TargetClass && !TargetClass->HasAnyClassFlags(CLASS_Abstract))
+			{
+				PendingClasses.Add(TargetClass);
+			}
+		}
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommand AIStatePoolStatsCommand(
+	TEXT("TrinityFlow.AI.StatePoolStats"),
+	TEXT("Logs AI state transitions per second and state allocations avoided since the last call"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		static double LastTime = FPlatformTime::Seconds();
+		static uint64 LastTransitions = 0;
+		static uint64 LastAvoided = 0;
+
+		const double Now = FPlatformTime::Seconds();
+		const double Elapsed = FMath::Max(Now - LastTime, UE_DOUBLE_SMALL_NUMBER);
+		const uint64 Transitions = UAIStateMachine::GetTotalTransitions();
+		const uint64 Avoided = UAIStateMachine::GetTotalAllocationsAvoided();
+
+		UE_LOG(LogTemp, Log, TEXT("AI state pool: %.1f transitions/s, %llu allocations avoided over %.1fs (%llu transitions, %llu avoided total)"),
+			(Transitions - LastTransitions) / Elapsed, Avoided - LastAvoided, Elapsed, Transitions, Avoided);
+
+		LastTime = Now;
+		LastTransitions = Transitions;
+		LastAvoided = Avoided;
+	}));
+#endif
\ No newline at end of file
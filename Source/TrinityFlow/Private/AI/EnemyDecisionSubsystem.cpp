@@ -0,0 +1,97 @@
+#include "AI/EnemyDecisionSubsystem.h"
+#include "Core/TrinityFlowProfiling.h"
+#include "AI/AIStateMachine.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<bool> CVarParallelDecisions(
+	TEXT("TrinityFlow.AI.ParallelDecisions"),
+	true,
+	TEXT("Evaluate enemy AI decisions on worker threads"));
+
+static TAutoConsoleVariable<int32> CVarParallelDecisionMinBatch(
+	TEXT("TrinityFlow.AI.ParallelDecisionMinBatch"),
+	16,
+	TEXT("Fewer queued decisions than this are evaluated on the game thread"));
+
+void UEnemyDecisionSubsystem::Deinitialize()
+{
+	Jobs.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UEnemyDecisionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyDecisionSubsystem, STATGROUP_TrinityFlow);
+}
+
+void UEnemyDecisionSubsystem::Enqueue(UAIStateMachine* StateMachine, float DeltaTime)
+{
+	FDecisionJob& Job = Jobs.AddDefaulted_GetRef();
+	if (!StateMachine->GatherSnapshot(DeltaTime, Job.Snapshot))
+	{
+		Jobs.Pop(EAllowShrinking::No);
+		return;
+	}
+
+	Job.StateMachine = StateMachine;
+	Job.State = StateMachine->GetCurrentState();
+}
+
+void UEnemyDecisionSubsystem::Tick(float DeltaTime)
+{
+	DecisionsLastFrame = Jobs.Num();
+	EvaluateMsLastFrame = 0.0;
+	ApplyMsLastFrame = 0.0;
+	bParallelLastFrame = false;
+
+	if (Jobs.Num() == 0)
+	{
+		return;
+	}
+
+	TRINITYFLOW_INC_COUNTER(AIDecisions, Jobs.Num());
+
+	// Evaluate: snapshot in, decision out; each job touches only its own state instance
+	const double EvaluateStart = FPlatformTime::Seconds();
+	bParallelLastFrame = CVarParallelDecisions.GetValueOnGameThread() && Jobs.Num() >= CVarParallelDecisionMinBatch.GetValueOnGameThread();
+
+	ParallelFor(Jobs.Num(), [this](int32 JobIndex)
+	{
+		FDecisionJob& Job = Jobs[JobIndex];
+		Job.State->Evaluate(Job.Snapshot, Job.Decision);
+	}, !bParallelLastFrame);
+
+	const double ApplyStart = FPlatformTime::Seconds();
+	EvaluateMsLastFrame = (ApplyStart - EvaluateStart) * 1000.0;
+
+	// Apply: side effects on the game thread. A machine whose state changed since it was
+	// snapshotted (e.g. re-initialized) drops its stale decision.
+	for (FDecisionJob& Job : Jobs)
+	{
+		UAIStateMachine* StateMachine = Job.StateMachine.Get();
+		if (StateMachine && StateMachine->GetCurrentState() == Job.State)
+		{
+			Job.State->Apply(Job.Snapshot, Job.Decision);
+		}
+	}
+
+	ApplyMsLastFrame = (FPlatformTime::Seconds() - ApplyStart) * 1000.0;
+	Jobs.Reset();
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorld DecisionStatsCommand(
+	TEXT("TrinityFlow.AI.DecisionStats"),
+	TEXT("Logs the cost of the last enemy decision phase"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UEnemyDecisionSubsystem* Decisions = World ? World->GetSubsystem<UEnemyDecisionSubsystem>() : nullptr)
+		{
+			UE_LOG(LogTemp, Log, TEXT("Enemy decisions: %d last frame (%s), evaluate %.3f ms, apply %.3f ms"),
+				Decisions->GetDecisionsLastFrame(), Decisions->WasParallelLastFrame() ? TEXT("parallel") : TEXT("game thread"),
+				Decisions->GetEvaluateMsLastFrame(), Decisions->GetApplyMsLastFrame());
+		}
+	}));
+#endif
@@ -0,0 +1,623 @@
+#include "AI/EnemyHordeSubsystem.h"
+#include "Core/TrinityFlowProfiling.h"
+#include "Enemy/EnemyBase.h"
+#include "Core/CombatantHandleSubsystem.h"
+#include "Core/CombatResolutionSubsystem.h"
+#include "Core/EnemySpawner.h"
+#include "Core/HealthComponent.h"
+#include "Core/StateComponent.h"
+#include "Core/TrinityFlowStatsSubsystem.h"
+#include "Data/TrinityFlowCharacterStats.h"
+#include "AI/AIStateMachine.h"
+#include "AI/EnemyPerceptionSubsystem.h"
+#include "AI/States/AIState_Attack.h"
+#include "AI/States/AIState_Chase.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+void UEnemyHordeSubsystem::Deinitialize()
+{
+	Archetypes.Empty();
+	Locations.Empty();
+	Forwards.Empty();
+	Resources.Empty();
+	Tags.Empty();
+	States.Empty();
+	AIStates.Empty();
+	AttackCooldowns.Empty();
+	ArchetypeIndices.Empty();
+	RowIds.Empty();
+	IdToRow.Empty();
+	FreeIds.Empty();
+	PromotedEnemies.Empty();
+	DamageResponseCache.Reset();
+
+	RepresentationActor = nullptr;
+	RepresentationInstances = nullptr;
+
+	Super::Deinitialize();
+}
+
+TStatId UEnemyHordeSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyHordeSubsystem, STATGROUP_TrinityFlow);
+}
+
+UEnemyHordeSubsystem* UEnemyHordeSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UEnemyHordeSubsystem>() : nullptr;
+}
+
+int32 UEnemyHordeSubsystem::FindOrAddArchetype(TSubclassOf<AEnemyBase> EnemyClass)
+{
+	for (int32 Index = 0; Index < Archetypes.Num(); Index++)
+	{
+		if (Archetypes[Index].EnemyClass == EnemyClass)
+		{
+			return Index;
+		}
+	}
+
+	const AEnemyBase* Defaults = EnemyClass->GetDefaultObject<AEnemyBase>();
+
+	// Same stats lookup as AEnemyBase::SetupEnemy, done once per class
+	UTrinityFlowCharacterStats* Stats = Defaults->GetOverrideStats();
+	if (!Stats)
+	{
+		UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+		if (UTrinityFlowStatsSubsystem* StatsSubsystem = GameInstance ? GameInstance->GetSubsystem<UTrinityFlowStatsSubsystem>() : nullptr)
+		{
+			Stats = StatsSubsystem->GetCharacterStats(Defaults->GetEnemyStatsID());
+		}
+	}
+
+	FHordeArchetype& Archetype = Archetypes.AddDefaulted_GetRef();
+	Archetype.EnemyClass = EnemyClass;
+	Archetype.MovementSpeed = Defaults->MovementSpeed;
+	Archetype.SightRange = Defaults->GetSightRange();
+	Archetype.AttackRange = Defaults->GetAttackRange();
+
+	if (Stats)
+	{
+		Archetype.Resources = Stats->GetCharacterResources();
+		Archetype.Tags = Stats->GetCharacterTags();
+		Archetype.SightRange = Stats->SightRange;
+		Archetype.AttackRange = Stats->AttackRange;
+		Archetype.AttackInterval = Stats->AttackSpeed > 0.0f ? 1.0f / Stats->AttackSpeed : 1.0f;
+		if (Stats->MovementSpeed > 0.0f)
+		{
+			Archetype.MovementSpeed = Stats->MovementSpeed;
+		}
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("EnemyHorde: No stats for %s, using defaults"), *EnemyClass->GetName());
+	}
+
+	return Archetypes.Num() - 1;
+}
+
+FHordeEntityId UEnemyHordeSubsystem::SpawnEntity(TSubclassOf<AEnemyBase> EnemyClass, const FVector& Location, const FRotator& Rotation)
+{
+	if (!EnemyClass)
+	{
+		return FHordeEntityId();
+	}
+
+	const int32 ArchetypeIndex = FindOrAddArchetype(EnemyClass);
+	const int32 Row = AddRow(ArchetypeIndex, Location, Rotation.Vector(), Archetypes[ArchetypeIndex].Resources, ECharacterState::NonCombat);
+
+	FHordeEntityId Entity;
+	Entity.Id = RowIds[Row];
+	return Entity;
+}
+
+void UEnemyHordeSubsystem::DestroyEntity(FHordeEntityId Entity)
+{
+	if (IdToRow.IsValidIndex(Entity.Id) && IdToRow[Entity.Id] != INDEX_NONE)
+	{
+		RemoveRow(IdToRow[Entity.Id]);
+	}
+}
+
+bool UEnemyHordeSubsystem::GetEntityLocation(FHordeEntityId Entity, FVector& OutLocation) const
+{
+	if (!IdToRow.IsValidIndex(Entity.Id) || IdToRow[Entity.Id] == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutLocation = Locations[IdToRow[Entity.Id]];
+	return true;
+}
+
+FHordeEntityId UEnemyHordeSubsystem::FindEntityInCone(const FVector& Origin, const FVector& Direction, float Range, float HalfAngleDegrees) const
+{
+	const FVector ConeDirection = Direction.GetSafeNormal();
+	const float MinCos = FMath::Cos(FMath::DegreesToRadians(HalfAngleDegrees));
+
+	float BestDistanceSquared = FMath::Square(Range);
+	int32 BestRow = INDEX_NONE;
+
+	for (int32 Row = 0; Row < Locations.Num(); Row++)
+	{
+		const FVector ToEntity = Locations[Row] - Origin;
+		const float DistanceSquared = ToEntity.SizeSquared();
+		if (DistanceSquared > BestDistanceSquared)
+		{
+			continue;
+		}
+
+		// Entities on top of the origin count as in front
+		if (DistanceSquared > UE_KINDA_SMALL_NUMBER && FVector::DotProduct(ToEntity, ConeDirection) < MinCos * FMath::Sqrt(DistanceSquared))
+		{
+			continue;
+		}
+
+		BestDistanceSquared = DistanceSquared;
+		BestRow = Row;
+	}
+
+	FHordeEntityId Entity;
+	Entity.Id = BestRow != INDEX_NONE ? RowIds[BestRow] : INDEX_NONE;
+	return Entity;
+}
+
+int32 UEnemyHordeSubsystem::AddRow(int32 ArchetypeIndex, const FVector& Location, const FVector& Forward, const FCharacterResources& InResources, ECharacterState InStates)
+{
+	const int32 Id = FreeIds.Num() > 0 ? FreeIds.Pop(EAllowShrinking::No) : IdToRow.Add(INDEX_NONE);
+
+	const int32 Row = Locations.Add(Location);
+	Forwards.Add(Forward.GetSafeNormal2D());
+	Resources.Add(InResources);
+	Tags.Add(Archetypes[ArchetypeIndex].Tags);
+	States.Add(InStates);
+	AIStates.Add(EHordeAIState::Idle);
+	AttackCooldowns.Add(0.0f);
+	ArchetypeIndices.Add(static_cast<uint16>(ArchetypeIndex));
+	RowIds.Add(Id);
+
+	IdToRow[Id] = Row;
+	return Row;
+}
+
+void UEnemyHordeSubsystem::RemoveRow(int32 Row)
+{
+	const int32 Id = RowIds[Row];
+	IdToRow[Id] = INDEX_NONE;
+	FreeIds.Add(Id);
+
+	Locations.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	Forwards.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	Resources.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	Tags.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	States.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	AIStates.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	AttackCooldowns.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	ArchetypeIndices.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+	RowIds.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+
+	// The last row now lives in the hole
+	if (RowIds.IsValidIndex(Row))
+	{
+		IdToRow[RowIds[Row]] = Row;
+	}
+}
+
+void UEnemyHordeSubsystem::Tick(float DeltaTime)
+{
+	PromotionsLastFrame = 0;
+	DemotionsLastFrame = 0;
+
+	APawn* Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+	if (Player)
+	{
+		const FVector PlayerLocation = Player->GetActorLocation();
+
+		DemoteFarEnemies(PlayerLocation);
+		ProcessIdle(PlayerLocation);
+		ProcessChase(PlayerLocation, DeltaTime);
+		ProcessAttack(Player, DeltaTime);
+		PromoteNearEntities(Player);
+	}
+
+	UpdateRepresentation();
+}
+
+void UEnemyHordeSubsystem::ProcessIdle(const FVector& PlayerLocation)
+{
+	// Horde entities have no line-of-sight check; distance alone starts the chase
+	for (int32 Row = 0; Row < Locations.Num(); Row++)
+	{
+		if (AIStates[Row] != EHordeAIState::Idle)
+		{
+			continue;
+		}
+
+		const float SightRange = Archetypes[ArchetypeIndices[Row]].SightRange;
+		if (FVector::DistSquared(Locations[Row], PlayerLocation) <= FMath::Square(SightRange))
+		{
+			AIStates[Row] = EHordeAIState::Chase;
+			States[Row] = (States[Row] & ~ECharacterState::NonCombat) | ECharacterState::Combat;
+		}
+	}
+}
+
+void UEnemyHordeSubsystem::ProcessChase(const FVector& PlayerLocation, float DeltaTime)
+{
+	// Straight-line movement on the XY plane; entities are promoted to navmesh-driven actors before
+	// they get close enough for obstacles around the player to matter
+	for (int32 Row = 0; Row < Locations.Num(); Row++)
+	{
+		if (AIStates[Row] != EHordeAIState::Chase)
+		{
+			continue;
+		}
+
+		const FHordeArchetype& Archetype = Archetypes[ArchetypeIndices[Row]];
+		FVector ToPlayer = PlayerLocation - Locations[Row];
+		ToPlayer.Z = 0.0f;
+
+		const float Distance = ToPlayer.Size();
+		if (Distance <= Archetype.AttackRange)
+		{
+			AIStates[Row] = EHordeAIState::Attack;
+			continue;
+		}
+
+		if (Distance > Archetype.SightRange * 2.0f)
+		{
+			AIStates[Row] = EHordeAIState::Idle;
+			States[Row] = (States[Row] & ~ECharacterState::Combat) | ECharacterState::NonCombat;
+			continue;
+		}
+
+		const FVector Direction = ToPlayer / Distance;
+		Locations[Row] += Direction * FMath::Min(Archetype.MovementSpeed * DeltaTime, Distance - Archetype.AttackRange);
+		Forwards[Row] = Direction;
+	}
+}
+
+void UEnemyHordeSubsystem::ProcessAttack(APawn* Player, float DeltaTime)
+{
+	// Only reached when the promotion budget is exhausted. Entities wait out their attack interval in
+	// range, then the attacker is promoted and its actor attack state performs the hit, so the player
+	// gets the same defensive window as for any other enemy
+	const FVector PlayerLocation = Player->GetActorLocation();
+
+	for (int32 Row = Locations.Num() - 1; Row >= 0; Row--)
+	{
+		if (AIStates[Row] != EHordeAIState::Attack)
+		{
+			continue;
+		}
+
+		const FHordeArchetype& Archetype = Archetypes[ArchetypeIndices[Row]];
+		if (FVector::DistSquared2D(Locations[Row], PlayerLocation) > FMath::Square(Archetype.AttackRange * 1.2f))
+		{
+			AIStates[Row] = EHordeAIState::Chase;
+			continue;
+		}
+
+		AttackCooldowns[Row] -= DeltaTime;
+		if (AttackCooldowns[Row] > 0.0f)
+		{
+			continue;
+		}
+
+		AttackCooldowns[Row] = Archetype.AttackInterval;
+
+		// No hits through walls; check again after the next interval
+		if (!HasLineOfSight(Row, Player))
+		{
+			continue;
+		}
+
+		if (PromoteRow(Row, Player))
+		{
+			PromotionsLastFrame++;
+		}
+	}
+}
+
+bool UEnemyHordeSubsystem::HasLineOfSight(int32 Row, const APawn* Player) const
+{
+	const FVector EyeOffset(0.0f, 0.0f, UEnemyPerceptionSubsystem::EyeHeight);
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(EnemyHordeSight), false);
+
+	FHitResult Hit;
+	const bool bHit = GetWorld()->LineTraceSingleByChannel(Hit, Locations[Row] + EyeOffset,
+		Player->GetActorLocation() + EyeOffset, ECC_Visibility, QueryParams);
+
+	return !bHit || Hit.GetActor() == Player;
+}
+
+void UEnemyHordeSubsystem::PromoteNearEntities(APawn* Player)
+{
+	const float PromoteDistanceSquared = FMath::Square(PromoteDistance);
+	const FVector PlayerLocation = Player->GetActorLocation();
+
+	for (int32 Row = Locations.Num() - 1; Row >= 0 && PromotionsLastFrame < MaxPromotionsPerFrame; Row--)
+	{
+		if (FVector::DistSquared(Locations[Row], PlayerLocation) > PromoteDistanceSquared)
+		{
+			continue;
+		}
+
+		if (PromoteRow(Row, Player))
+		{
+			PromotionsLastFrame++;
+		}
+	}
+}
+
+AEnemyBase* UEnemyHordeSubsystem::PromoteRow(int32 Row, APawn* Player)
+{
+	const FHordeArchetype& Archetype = Archetypes[ArchetypeIndices[Row]];
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	AEnemyBase* Enemy = GetWorld()->SpawnActor<AEnemyBase>(Archetype.EnemyClass, Locations[Row], Forwards[Row].Rotation(), SpawnParams);
+	if (!Enemy)
+	{
+		return nullptr;
+	}
+
+	// BeginPlay loaded full stats; carry over the damage taken while in the horde
+	if (UHealthComponent* Health = UCombatantHandleSubsystem::Get(Enemy).Health.Get())
+	{
+		Health->SetResources(Resources[Row]);
+	}
+
+	// BeginPlay also entered the initial (idle) state; resume what the entity was doing in the enemy's
+	// own configured state, whose transition classes are filled in (the native states leave them null)
+	if (AIStates[Row] != EHordeAIState::Idle)
+	{
+		Enemy->SetTargetPlayer(Player);
+
+		if (UAIStateMachine* StateMachine = Enemy->GetAIStateMachine())
+		{
+			const TSubclassOf<UAIState> BaseClass = AIStates[Row] == EHordeAIState::Attack
+				? UAIState_Attack::StaticClass()
+				: UAIState_Chase::StaticClass();
+
+			if (const TSubclassOf<UAIState> StateClass = StateMachine->FindStateClass(BaseClass))
+			{
+				StateMachine->ChangeState(StateClass);
+			}
+		}
+	}
+
+	PromotedEnemies.Add(Enemy);
+	RemoveRow(Row);
+	return Enemy;
+}
+
+void UEnemyHordeSubsystem::DemoteFarEnemies(const FVector& PlayerLocation)
+{
+	const float DemoteDistanceSquared = FMath::Square(DemoteDistance);
+
+	for (int32 Index = PromotedEnemies.Num() - 1; Index >= 0; Index--)
+	{
+		AEnemyBase* Enemy = PromotedEnemies[Index].Get();
+		if (!Enemy)
+		{
+			PromotedEnemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		if (FVector::DistSquared(Enemy->GetActorLocation(), PlayerLocation) <= DemoteDistanceSquared)
+		{
+			continue;
+		}
+
+		// Only enemies that have given up the chase go back to the horde
+		const FCombatantHandles& Handles = UCombatantHandleSubsystem::Get(Enemy);
+		UHealthComponent* Health = Handles.Health.Get();
+		UStateComponent* State = Handles.State.Get();
+		if (!Health || !Health->IsAlive() || (State && State->HasState(ECharacterState::Combat)))
+		{
+			continue;
+		}
+
+		const int32 ArchetypeIndex = FindOrAddArchetype(Enemy->GetClass());
+		AddRow(ArchetypeIndex, Enemy->GetActorLocation(), Enemy->GetActorForwardVector(), Health->GetResources(), ECharacterState::NonCombat);
+
+		PromotedEnemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		Enemy->Destroy();
+		DemotionsLastFrame++;
+	}
+}
+
+int32 UEnemyHordeSubsystem::ApplyRadialDamage(const FVector& Center, float Radius, const FDamageInfo& DamageInfo)
+{
+	const float RadiusSquared = FMath::Square(Radius);
+
+	DamageBatch.Reset(64);
+	BatchRows.Reset();
+
+	for (int32 Row = 0; Row < Locations.Num(); Row++)
+	{
+		if (FVector::DistSquared(Locations[Row], Center) > RadiusSquared)
+		{
+			continue;
+		}
+
+		DamageBatch.Add(DamageInfo, Resources[Row].DefencePoint, Tags[Row], (Locations[Row] - Center).GetSafeNormal(), Forwards[Row]);
+		BatchRows.Add(Row);
+	}
+
+	return ApplyBatchedDamage(DamageInfo);
+}
+
+float UEnemyHordeSubsystem::ApplyDamage(FHordeEntityId Entity, const FDamageInfo& DamageInfo, const FVector& DamageDirection)
+{
+	if (!IdToRow.IsValidIndex(Entity.Id) || IdToRow[Entity.Id] == INDEX_NONE)
+	{
+		return 0.0f;
+	}
+
+	const int32 Row = IdToRow[Entity.Id];
+	const float HealthBefore = Resources[Row].Health;
+
+	DamageBatch.Reset(1);
+	BatchRows.Reset();
+	DamageBatch.Add(DamageInfo, Resources[Row].DefencePoint, Tags[Row], DamageDirection, Forwards[Row]);
+	BatchRows.Add(Row);
+
+	ApplyBatchedDamage(DamageInfo);
+
+	// The row may have been removed by death
+	return IdToRow[Entity.Id] == INDEX_NONE ? HealthBefore : HealthBefore - Resources[Row].Health;
+}
+
+int32 UEnemyHordeSubsystem::ApplyBatchedDamage(const FDamageInfo& DamageInfo)
+{
+	const int32 NumHits = BatchRows.Num();
+	if (NumHits == 0)
+	{
+		return 0;
+	}
+
+	BatchDamage.SetNumUninitialized(NumHits, EAllowShrinking::No);
+	FDamageCalculator::CalculateDamageBatch(DamageBatch, BatchDamage,
+		FDamageCalculator::IsResponseCacheEnabled() ? &DamageResponseCache : nullptr);
+
+	// Apply in descending row order so swap-removing the dead does not disturb rows still to visit
+	for (int32 Hit = NumHits - 1; Hit >= 0; Hit--)
+	{
+		const int32 Row = BatchRows[Hit];
+		FCharacterResources& RowResources = Resources[Row];
+		const float ActualDamage = FMath::Min(RowResources.Health, BatchDamage[Hit]);
+		RowResources.Health -= ActualDamage;
+
+		if (ActualDamage > 0.0f)
+		{
+			PublishEvent(ECombatEventType::DamageDealt, Row, DamageInfo, ActualDamage);
+		}
+
+		// Being hit wakes the entity
+		if (BatchDamage[Hit] > 0.0f && AIStates[Row] == EHordeAIState::Idle)
+		{
+			AIStates[Row] = EHordeAIState::Chase;
+			States[Row] = (States[Row] & ~ECharacterState::NonCombat) | ECharacterState::Combat;
+		}
+
+		if (RowResources.Health <= 0.0f)
+		{
+			PublishEvent(ECombatEventType::Death, Row, DamageInfo, 0.0f);
+			RemoveRow(Row);
+		}
+	}
+
+	return NumHits;
+}
+
+void UEnemyHordeSubsystem::PublishEvent(ECombatEventType Type, int32 Row, const FDamageInfo& DamageInfo, float Amount) const
+{
+	if (FCombatEventBus* EventBus = UCombatResolutionSubsystem::GetEventBus(this))
+	{
+		FCombatEvent Event;
+		Event.Type = Type;
+		Event.Instigator = DamageInfo.Instigator;
+		Event.Location = Locations[Row];
+		Event.Amount = Amount;
+		Event.DamageType = DamageInfo.Type;
+		Event.bIsLeftWeapon = DamageInfo.bIsLeftWeapon;
+		EventBus->Publish(Event);
+	}
+}
+
+void UEnemyHordeSubsystem::SetRepresentationMesh(UStaticMesh* Mesh)
+{
+	if (!RepresentationInstances)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		RepresentationActor = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+		if (!RepresentationActor)
+		{
+			return;
+		}
+
+		RepresentationInstances = NewObject<UInstancedStaticMeshComponent>(RepresentationActor);
+		RepresentationInstances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		RepresentationInstances->SetCastShadow(false);
+		RepresentationActor->SetRootComponent(RepresentationInstances);
+		RepresentationInstances->RegisterComponent();
+	}
+
+	RepresentationInstances->SetStaticMesh(Mesh);
+}
+
+void UEnemyHordeSubsystem::UpdateRepresentation()
+{
+	if (!RepresentationInstances)
+	{
+		return;
+	}
+
+	InstanceTransforms.SetNum(Locations.Num(), EAllowShrinking::No);
+	for (int32 Row = 0; Row < Locations.Num(); Row++)
+	{
+		InstanceTransforms[Row] = FTransform(Forwards[Row].Rotation(), Locations[Row]);
+	}
+
+	// Rows are swap-removed, so instance order only stays in sync while the count is unchanged
+	if (RepresentationInstances->GetInstanceCount() != InstanceTransforms.Num())
+	{
+		RepresentationInstances->ClearInstances();
+		RepresentationInstances->AddInstances(InstanceTransforms, false, true);
+	}
+	else if (InstanceTransforms.Num() > 0)
+	{
+		RepresentationInstances->BatchUpdateInstancesTransforms(0, InstanceTransforms, true, true);
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorldAndArgs HordeSpawnCommand(
+	TEXT("TrinityFlow.Horde.Spawn"),
+	TEXT("Spawns horde enemies in a ring around the player. Usage: TrinityFlow.Horde.Spawn [Count] [Radius]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UEnemyHordeSubsystem* Horde = World ? World->GetSubsystem<UEnemyHordeSubsystem>() : nullptr;
+		APawn* Player = World ? UGameplayStatics::GetPlayerPawn(World, 0) : nullptr;
+		if (!Horde || !Player)
+		{
+			return;
+		}
+
+		const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+		const float Radius = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 8000.0f;
+
+		TSubclassOf<AEnemyBase> EnemyClass = AEnemySpawner::GetEnemyClassForType(EEnemyType::Standard);
+		FRandomStream Random(Count);
+
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			const float Angle = Random.FRandRange(0.0f, UE_TWO_PI);
+			const float Distance = Random.FRandRange(UEnemyHordeSubsystem::DemoteDistance, FMath::Max(Radius, UEnemyHordeSubsystem::DemoteDistance));
+			const FVector Location = Player->GetActorLocation() + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * Distance;
+			Horde->SpawnEntity(EnemyClass, Location, (Player->GetActorLocation() - Location).Rotation());
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("EnemyHorde: Spawned %d entities (%d total)"), Count, Horde->GetNumEntities());
+	}));
+
+static FAutoConsoleCommandWithWorld HordeStatsCommand(
+	TEXT("TrinityFlow.Horde.Stats"),
+	TEXT("Logs horde entity and promoted actor counts"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UEnemyHordeSubsystem* Horde = World ? World->GetSubsystem<UEnemyHordeSubsystem>() : nullptr)
+		{
+			UE_LOG(LogTemp, Log, TEXT("EnemyHorde: %d entities, %d promoted actors, %d promotions and %d demotions last frame"),
+				Horde->GetNumEntities(), Horde->GetNumPromoted(), Horde->GetPromotionsLastFrame(), Horde->GetDemotionsLastFrame());
+		}
+	}));
+#endif
@@ -0,0 +1,219 @@
+#include "AI/EnemyPerceptionSubsystem.h"
+#include "Core/TrinityFlowProfiling.h"
+#include "AI/EnemySignificanceSubsystem.h"
+#include "Enemy/EnemyBase.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarPerceptionTracesPerFrame(
+	TEXT("TrinityFlow.Perception.TracesPerFrame"),
+	16,
+	TEXT("Maximum number of line-of-sight traces the enemy perception subsystem issues per frame"));
+
+static TAutoConsoleVariable<float> CVarPerceptionRefreshInterval(
+	TEXT("TrinityFlow.Perception.RefreshInterval"),
+	0.2f,
+	TEXT("Seconds before a visibility record is traced again"));
+
+namespace
+{
+	// Records nobody asked about for this long stop refreshing
+	constexpr double PerceptionQueryTimeout = 1.0;
+}
+
+void UEnemyPerceptionSubsystem::Deinitialize()
+{
+	Records.Empty();
+	FreeRecords.Empty();
+	RecordIndices.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UEnemyPerceptionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyPerceptionSubsystem, STATGROUP_TrinityFlow);
+}
+
+void UEnemyPerceptionSubsystem::Register(AEnemyBase* Enemy)
+{
+	FindOrAddRecord(Enemy);
+}
+
+void UEnemyPerceptionSubsystem::Unregister(AEnemyBase* Enemy)
+{
+	int32 RecordIndex;
+	if (RecordIndices.RemoveAndCopyValue(Enemy, RecordIndex))
+	{
+		// Any in-flight trace for this record is ignored because the handle no longer matches
+		Records[RecordIndex] = FVisibilityRecord();
+		FreeRecords.Add(RecordIndex);
+	}
+}
+
+void UEnemyPerceptionSubsystem::OnEnemyEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+	Unregister(Cast<AEnemyBase>(Actor));
+}
+
+int32 UEnemyPerceptionSubsystem::FindOrAddRecord(AEnemyBase* Enemy)
+{
+	if (!Enemy)
+	{
+		return INDEX_NONE;
+	}
+
+	if (const int32* Found = RecordIndices.Find(Enemy))
+	{
+		return *Found;
+	}
+
+	const int32 RecordIndex = FreeRecords.Num() > 0 ? FreeRecords.Pop(EAllowShrinking::No) : Records.AddDefaulted();
+	FVisibilityRecord& Record = Records[RecordIndex];
+	Record.Enemy = Enemy;
+	Record.bInUse = true;
+	RecordIndices.Add(Enemy, RecordIndex);
+
+	Enemy->OnEndPlay.AddUniqueDynamic(this, &UEnemyPerceptionSubsystem::OnEnemyEndPlay);
+	return RecordIndex;
+}
+
+EEnemyVisibility UEnemyPerceptionSubsystem::GetVisibility(AEnemyBase* Enemy, AActor* Target)
+{
+	const int32 RecordIndex = FindOrAddRecord(Enemy);
+	if (RecordIndex == INDEX_NONE || !Target)
+	{
+		return EEnemyVisibility::Unknown;
+	}
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	FVisibilityRecord& Record = Records[RecordIndex];
+	Record.LastQueryTime = Now;
+
+	// A new target invalidates the cached result and jumps the queue
+	if (Record.Target.Get() != Target)
+	{
+		Record.Target = Target;
+		Record.Visibility = EEnemyVisibility::Unknown;
+		Record.LastRefreshTime = -1.0;
+		Record.PendingTrace = FTraceHandle();
+	}
+	// So does a result that stopped refreshing while nobody was asking (the enemy sat idle or dormant)
+	else if (Now - Record.LastRefreshTime > CVarPerceptionRefreshInterval.GetValueOnGameThread() + PerceptionQueryTimeout)
+	{
+		Record.Visibility = EEnemyVisibility::Unknown;
+		Record.LastRefreshTime = -1.0;
+	}
+
+	return Record.Visibility;
+}
+
+void UEnemyPerceptionSubsystem::Tick(float DeltaTime)
+{
+	TRINITYFLOW_SCOPE_CYCLE_COUNTER(PerceptionDispatch);
+
+	TracesIssuedLastFrame = 0;
+
+	const int32 NumRecords = Records.Num();
+	if (NumRecords == 0)
+	{
+		return;
+	}
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	const double RefreshInterval = CVarPerceptionRefreshInterval.GetValueOnGameThread();
+	const int32 Budget = FMath::Max(1, CVarPerceptionTracesPerFrame.GetValueOnGameThread());
+
+	// Unknown records (new targets) go first so callers get an answer within a frame or two
+	for (int32 RecordIndex = 0; RecordIndex < NumRecords && TracesIssuedLastFrame < Budget; RecordIndex++)
+	{
+		const FVisibilityRecord& Record = Records[RecordIndex];
+		if (Record.bInUse && Record.Visibility == EEnemyVisibility::Unknown && Record.Target.IsValid() && !Record.PendingTrace.IsValid())
+		{
+			IssueTrace(RecordIndex);
+		}
+	}
+
+	// Then stale records in round-robin order
+	for (int32 Visited = 0; Visited < NumRecords && TracesIssuedLastFrame < Budget; Visited++)
+	{
+		RefreshCursor = (RefreshCursor + 1) % NumRecords;
+
+		const FVisibilityRecord& Record = Records[RefreshCursor];
+		if (!Record.bInUse || !Record.Target.IsValid() || Record.PendingTrace.IsValid())
+		{
+			continue;
+		}
+
+		if (Now - Record.LastQueryTime > PerceptionQueryTimeout || Now - Record.LastRefreshTime < RefreshInterval)
+		{
+			continue;
+		}
+
+		IssueTrace(RefreshCursor);
+	}
+}
+
+void UEnemyPerceptionSubsystem::IssueTrace(int32 RecordIndex)
+{
+	FVisibilityRecord& Record = Records[RecordIndex];
+	AEnemyBase* Enemy = Record.Enemy.Get();
+	AActor* Target = Record.Target.Get();
+	if (!Enemy || !Target)
+	{
+		return;
+	}
+
+	if (!TraceDelegate.IsBound())
+	{
+		TraceDelegate.BindUObject(this, &UEnemyPerceptionSubsystem::OnTraceCompleted);
+	}
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(EnemyPerception), false, Enemy);
+
+	Record.PendingTrace = GetWorld()->AsyncLineTraceByChannel(
+		EAsyncTraceType::Single,
+		Enemy->GetActorLocation() + FVector(0, 0, EyeHeight),
+		Target->GetActorLocation() + FVector(0, 0, EyeHeight),
+		ECC_Visibility,
+		QueryParams,
+		FCollisionResponseParams::DefaultResponseParam,
+		&TraceDelegate,
+		static_cast<uint32>(RecordIndex));
+
+	Record.LastRefreshTime = GetWorld()->GetTimeSeconds();
+	TracesIssuedLastFrame++;
+	TRINITYFLOW_INC_COUNTER(PerceptionTraces, 1);
+}
+
+void UEnemyPerceptionSubsystem::OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	const int32 RecordIndex = static_cast<int32>(Datum.UserData);
+	if (!Records.IsValidIndex(RecordIndex))
+	{
+		return;
+	}
+
+	// Ignore results for records that were removed or retargeted since the trace was issued
+	FVisibilityRecord& Record = Records[RecordIndex];
+	if (!Record.bInUse || !(Record.PendingTrace == Handle))
+	{
+		return;
+	}
+
+	Record.PendingTrace = FTraceHandle();
+
+	const FHitResult* BlockingHit = Datum.OutHits.FindByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+	const bool bVisible = !BlockingHit || BlockingHit->GetActor() == Record.Target.Get();
+
+	// Spotting the target wakes a throttled enemy so it reacts this frame rather than on its next reduced-rate tick
+	if (bVisible && Record.Visibility != EEnemyVisibility::Visible)
+	{
+		if (UEnemySignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UEnemySignificanceSubsystem>())
+		{
+			Significance->Wake(Record.Enemy.Get());
+		}
+	}
+
+	Record.Visibility = bVisible ? EEnemyVisibility::Visible : EEnemyVisibility::Blocked;
+}
@@ -0,0 +1,243 @@
+#include "AI/EnemySignificanceSubsystem.h"
+#include "Core/TrinityFlowProfiling.h"
+#include "AI/AIStateMachine.h"
+#include "Enemy/EnemyBase.h"
+#include "Core/CombatComponent.h"
+#include "Core/CombatResolutionSubsystem.h"
+#include "Core/StateComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<bool> CVarSignificanceEnabled(
+	TEXT("TrinityFlow.Significance.Enabled"),
+	true,
+	TEXT("When false every enemy ticks at full rate"));
+
+namespace
+{
+	// Tick interval per bucket; negative means ticking is disabled
+	constexpr float SignificanceTickIntervals[] = { 0.0f, 0.2f, 1.0f, -1.0f };
+	static_assert(UE_ARRAY_COUNT(SignificanceTickIntervals) == static_cast<int32>(EEnemySignificance::Count), "One interval per significance bucket");
+
+	// Dormant disables ticking, but a tick re-enabled by its owner (the combat component finishing a
+	// cast) still runs; give it a long interval rather than 0, which would tick every frame
+	constexpr float DormantTickInterval = 2.0f;
+
+	float GetTickInterval(float Interval)
+	{
+		return Interval >= 0.0f ? Interval : DormantTickInterval;
+	}
+
+	void SetComponentTickRate(UActorComponent* Component, float Interval)
+	{
+		if (!Component)
+		{
+			return;
+		}
+
+		Component->SetComponentTickEnabled(Interval >= 0.0f);
+		Component->SetComponentTickInterval(GetTickInterval(Interval));
+	}
+}
+
+void UEnemySignificanceSubsystem::Deinitialize()
+{
+	if (DamageEventHandle.IsValid())
+	{
+		if (FCombatEventBus* EventBus = UCombatResolutionSubsystem::GetEventBus(this))
+		{
+			EventBus->Unsubscribe(ECombatEventType::DamageDealt, DamageEventHandle);
+		}
+		DamageEventHandle.Reset();
+	}
+
+	Records.Empty();
+	RecordIndices.Empty();
+	FMemory::Memzero(BucketCounts);
+
+	Super::Deinitialize();
+}
+
+TStatId UEnemySignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemySignificanceSubsystem, STATGROUP_TrinityFlow);
+}
+
+void UEnemySignificanceSubsystem::Register(AEnemyBase* Enemy)
+{
+	if (!Enemy || RecordIndices.Contains(Enemy))
+	{
+		return;
+	}
+
+	// The resolution subsystem may be created after this one, so subscribe on first use
+	if (!DamageEventHandle.IsValid())
+	{
+		if (FCombatEventBus* EventBus = UCombatResolutionSubsystem::GetEventBus(this))
+		{
+			DamageEventHandle = EventBus->Subscribe(ECombatEventType::DamageDealt,
+				FOnCombatEvent::FDelegate::CreateUObject(this, &UEnemySignificanceSubsystem::OnDamageEvent));
+		}
+	}
+
+	// New enemies start at full rate and are bucketed on the next evaluation
+	FSignificanceRecord& Record = Records.AddDefaulted_GetRef();
+	Record.Enemy = Enemy;
+	Record.Key = Enemy;
+	Record.Significance = EEnemySignificance::Near;
+	RecordIndices.Add(Enemy, Records.Num() - 1);
+	BucketCounts[static_cast<int32>(EEnemySignificance::Near)]++;
+
+	Enemy->OnEndPlay.AddUniqueDynamic(this, &UEnemySignificanceSubsystem::OnEnemyEndPlay);
+}
+
+void UEnemySignificanceSubsystem::Unregister(AEnemyBase* Enemy)
+{
+	int32 RecordIndex;
+	if (RecordIndices.RemoveAndCopyValue(Enemy, RecordIndex))
+	{
+		RemoveRecord(RecordIndex);
+	}
+}
+
+void UEnemySignificanceSubsystem::RemoveRecord(int32 RecordIndex)
+{
+	BucketCounts[static_cast<int32>(Records[RecordIndex].Significance)]--;
+
+	// Swap the last record into the hole and fix up its index
+	Records.RemoveAtSwap(RecordIndex, 1, EAllowShrinking::No);
+	if (Records.IsValidIndex(RecordIndex))
+	{
+		RecordIndices.Add(Records[RecordIndex].Key, RecordIndex);
+	}
+}
+
+void UEnemySignificanceSubsystem::OnEnemyEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+	Unregister(Cast<AEnemyBase>(Actor));
+}
+
+void UEnemySignificanceSubsystem::Wake(AEnemyBase* Enemy)
+{
+	if (const int32* RecordIndex = RecordIndices.Find(Enemy))
+	{
+		Apply(Records[*RecordIndex], EEnemySignificance::Near);
+	}
+}
+
+EEnemySignificance UEnemySignificanceSubsystem::GetSignificance(const AEnemyBase* Enemy) const
+{
+	const int32* RecordIndex = RecordIndices.Find(Enemy);
+	return RecordIndex ? Records[*RecordIndex].Significance : EEnemySignificance::Near;
+}
+
+void UEnemySignificanceSubsystem::OnDamageEvent(const FCombatEvent& Event)
+{
+	// Both sides of a hit need full-rate AI: the victim to react, the attacker to follow up
+	Wake(Cast<AEnemyBase>(Event.Target));
+	Wake(Cast<AEnemyBase>(Event.Instigator));
+}
+
+void UEnemySignificanceSubsystem::Tick(float DeltaTime)
+{
+	TimeSinceEvaluation += DeltaTime;
+	if (TimeSinceEvaluation < EvaluationInterval || Records.Num() == 0)
+	{
+		return;
+	}
+	TimeSinceEvaluation = 0.0f;
+
+	const APawn* Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+	const FVector PlayerLocation = Player ? Player->GetActorLocation() : FVector::ZeroVector;
+	const bool bEnabled = CVarSignificanceEnabled.GetValueOnGameThread();
+
+	for (int32 RecordIndex = Records.Num() - 1; RecordIndex >= 0; RecordIndex--)
+	{
+		FSignificanceRecord& Record = Records[RecordIndex];
+		const AEnemyBase* Enemy = Record.Enemy.Get();
+		if (!Enemy)
+		{
+			RecordIndices.Remove(Record.Key);
+			RemoveRecord(RecordIndex);
+			continue;
+		}
+
+		Apply(Record, bEnabled ? Evaluate(Enemy, PlayerLocation, Player != nullptr) : EEnemySignificance::Near);
+	}
+}
+
+EEnemySignificance UEnemySignificanceSubsystem::Evaluate(const AEnemyBase* Enemy, const FVector& PlayerLocation, bool bHasPlayer) const
+{
+	const UStateComponent* StateComponent = Enemy->GetStateComponent();
+	if (StateComponent && StateComponent->HasState(ECharacterState::Combat))
+	{
+		return EEnemySignificance::Near;
+	}
+
+	if (!bHasPlayer)
+	{
+		return EEnemySignificance::Far;
+	}
+
+	const float DistanceSquared = FVector::DistSquared(Enemy->GetActorLocation(), PlayerLocation);
+	if (DistanceSquared <= FMath::Square(NearDistance))
+	{
+		return EEnemySignificance::Near;
+	}
+
+	// Idle enemies must keep ticking while the player could walk into their sight range before the next evaluation
+	const float WakeDistance = Enemy->GetSightRange() + FarWakeMargin;
+	if (DistanceSquared <= FMath::Square(WakeDistance))
+	{
+		return EEnemySignificance::Mid;
+	}
+
+	return EEnemySignificance::Dormant;
+}
+
+void UEnemySignificanceSubsystem::Apply(FSignificanceRecord& Record, EEnemySignificance NewSignificance)
+{
+	if (Record.Significance == NewSignificance)
+	{
+		return;
+	}
+
+	BucketCounts[static_cast<int32>(Record.Significance)]--;
+	BucketCounts[static_cast<int32>(NewSignificance)]++;
+	Record.Significance = NewSignificance;
+
+	AEnemyBase* Enemy = Record.Enemy.Get();
+	if (!Enemy)
+	{
+		return;
+	}
+
+	const float Interval = SignificanceTickIntervals[static_cast<int32>(NewSignificance)];
+	Enemy->SetActorTickEnabled(Interval >= 0.0f);
+	Enemy->SetActorTickInterval(GetTickInterval(Interval));
+
+	SetComponentTickRate(Enemy->GetAIStateMachine(), Interval);
+
+	// The combat component enables its own tick while casting; only its rate is throttled here
+	if (UCombatComponent* CombatComponent = Enemy->GetCombatComponent())
+	{
+		CombatComponent->SetComponentTickInterval(GetTickInterval(Interval));
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorld SignificanceStatsCommand(
+	TEXT("TrinityFlow.Significance.Stats"),
+	TEXT("Logs how many enemies are in each tick significance bucket"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UEnemySignificanceSubsystem* Significance = World ? World->GetSubsystem<UEnemySignificanceSubsystem>() : nullptr)
+		{
+			UE_LOG(LogTemp, Log, TEXT("Enemy significance: %d near, %d mid (5 Hz), %d far (1 Hz), %d dormant"),
+				Significance->GetNumInBucket(EEnemySignificance::Near),
+				Significance->GetNumInBucket(EEnemySignificance::Mid),
+				Significance->GetNumInBucket(EEnemySignificance::Far),
+				Significance->GetNumInBucket(EEnemySignificance::Dormant));
+		}
+	}));
+#endif
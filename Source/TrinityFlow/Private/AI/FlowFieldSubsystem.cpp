@@ -0,0 +1,358 @@
+#include "AI/FlowFieldSubsystem.h"
+#include "Core/TrinityFlowProfiling.h"
+#include "NavigationSystem.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<bool> CVarFlowFieldEnabled(
+	TEXT("TrinityFlow.FlowField.Enabled"),
+	true,
+	TEXT("When false chasing enemies use per-enemy navmesh paths only"));
+
+static TAutoConsoleVariable<int32> CVarFlowFieldProbesPerFrame(
+	TEXT("TrinityFlow.FlowField.ProbesPerFrame"),
+	512,
+	TEXT("Navmesh projections and raycasts a flow field build may issue per frame before it continues on the next"));
+
+namespace
+{
+	const FIntPoint FlowFieldNeighbours[] =
+	{
+		FIntPoint(1, 0), FIntPoint(-1, 0), FIntPoint(0, 1), FIntPoint(0, -1),
+		FIntPoint(1, 1), FIntPoint(1, -1), FIntPoint(-1, 1), FIntPoint(-1, -1)
+	};
+
+	// Bit of a 4-neighbour offset in the open edge masks, in FlowFieldNeighbours order
+	uint8 EdgeBit(const FIntPoint& Offset)
+	{
+		return Offset.X > 0 ? 1 : Offset.X < 0 ? 2 : Offset.Y > 0 ? 4 : 8;
+	}
+
+	// Probe cache entries kept before the cache is dropped and re-probed
+	constexpr int32 MaxCachedCells = UFlowFieldSubsystem::GridSize * UFlowFieldSubsystem::GridSize * 4;
+}
+
+void UFlowFieldSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&InWorld))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.AddUniqueDynamic(this, &UFlowFieldSubsystem::OnNavigationGenerationFinished);
+	}
+}
+
+void UFlowFieldSubsystem::Deinitialize()
+{
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.RemoveDynamic(this, &UFlowFieldSubsystem::OnNavigationGenerationFinished);
+	}
+
+	Costs.Empty();
+	OpenEdges.Empty();
+	BuildCosts.Empty();
+	BuildOpenEdges.Empty();
+	BuildFrontier.Empty();
+	ProbeCache.Empty();
+	bHasField = false;
+	bBuilding = false;
+
+	Super::Deinitialize();
+}
+
+TStatId UFlowFieldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFlowFieldSubsystem, STATGROUP_TrinityFlow);
+}
+
+void UFlowFieldSubsystem::OnNavigationGenerationFinished(ANavigationData* NavData)
+{
+	// The old field may lead through new obstacles; re-probe everything on the next build
+	ProbeCache.Reset();
+	bHasField = false;
+	bBuilding = false;
+}
+
+FIntPoint UFlowFieldSubsystem::WorldToCell(const FVector& Location)
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+FIntVector UFlowFieldSubsystem::MakeProbeKey(const FIntPoint& Cell, float ProbeZ)
+{
+	return FIntVector(Cell.X, Cell.Y, FMath::FloorToInt32(ProbeZ / ProbeBandHeight));
+}
+
+int32 UFlowFieldSubsystem::GetCellIndex(const FIntPoint& Cell, const FIntPoint& Origin)
+{
+	const FIntPoint Local = Cell - Origin;
+	if (Local.X < 0 || Local.Y < 0 || Local.X >= GridSize || Local.Y >= GridSize)
+	{
+		return INDEX_NONE;
+	}
+
+	return Local.Y * GridSize + Local.X;
+}
+
+void UFlowFieldSubsystem::Tick(float DeltaTime)
+{
+	ProbesThisFrame = 0;
+
+	const APawn* Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+	if (!Player || !CVarFlowFieldEnabled.GetValueOnGameThread())
+	{
+		bHasField = false;
+		bBuilding = false;
+		return;
+	}
+
+	PlayerLocation = Player->GetActorLocation();
+
+	// No chaser has asked for the field lately; do not spend navmesh probes on it
+	if (GFrameCounter - LastQueryFrame.load(std::memory_order_relaxed) > IdleFrames)
+	{
+		return;
+	}
+
+	// Integration only changes when the goal cell does
+	const FIntPoint NewPlayerCell = WorldToCell(PlayerLocation);
+	const bool bFieldCurrent = bHasField && NewPlayerCell == PlayerCell;
+	if (!bFieldCurrent && (!bBuilding || NewPlayerCell != BuildPlayerCell))
+	{
+		BeginBuild(PlayerLocation);
+	}
+
+	if (bBuilding)
+	{
+		ContinueBuild();
+	}
+}
+
+UFlowFieldSubsystem::FCellProbe UFlowFieldSubsystem::ProbeCell(UNavigationSystemV1& NavSys, const FIntPoint& Cell, float ProbeZ)
+{
+	const FIntVector Key = MakeProbeKey(Cell, ProbeZ);
+	if (const FCellProbe* Cached = ProbeCache.Find(Key))
+	{
+		return *Cached;
+	}
+
+	const FVector CellCenter((Cell.X + 0.5f) * CellSize, (Cell.Y + 0.5f) * CellSize, ProbeZ);
+	FNavLocation NavLocation;
+
+	FCellProbe Probe;
+	Probe.bWalkable = NavSys.ProjectPointToNavigation(CellCenter, NavLocation, FVector(CellSize * 0.5f, CellSize * 0.5f, 500.0f));
+	Probe.NavPoint = Probe.bWalkable ? NavLocation.Location : CellCenter;
+
+	ProbeCache.Add(Key, Probe);
+	BuildProbes++;
+	ProbesThisFrame++;
+	return Probe;
+}
+
+bool UFlowFieldSubsystem::IsEdgeOpen(UNavigationSystemV1& NavSys, const FIntPoint& Cell, const FIntPoint& Offset, float ProbeZ)
+{
+	// Each link is cached once, on the cell at its -X / -Y end
+	const bool bForward = Offset.X > 0 || Offset.Y > 0;
+	const FIntPoint From = bForward ? Cell : Cell + Offset;
+	const FIntPoint To = bForward ? Cell + Offset : Cell;
+	const uint8 AxisBit = Offset.X != 0 ? 1 : 2;
+
+	const FCellProbe FromProbe = ProbeCell(NavSys, From, ProbeZ);
+	const FCellProbe ToProbe = ProbeCell(NavSys, To, ProbeZ);
+	if (!FromProbe.bWalkable || !ToProbe.bWalkable)
+	{
+		return false;
+	}
+
+	if (FromProbe.EdgesProbed & AxisBit)
+	{
+		return (FromProbe.EdgesOpen & AxisBit) != 0;
+	}
+
+	// Both centres can be on the navmesh with a wall or drop between them
+	FVector HitLocation;
+	const bool bBlocked = UNavigationSystemV1::NavigationRaycast(GetWorld(), FromProbe.NavPoint, ToProbe.NavPoint, HitLocation);
+
+	FCellProbe& Cached = ProbeCache.FindChecked(MakeProbeKey(From, ProbeZ));
+	Cached.EdgesProbed |= AxisBit;
+	Cached.EdgesOpen |= bBlocked ? 0 : AxisBit;
+
+	BuildProbes++;
+	ProbesThisFrame++;
+	return !bBlocked;
+}
+
+void UFlowFieldSubsystem::BeginBuild(const FVector& NewPlayerLocation)
+{
+	if (ProbeCache.Num() > MaxCachedCells)
+	{
+		ProbeCache.Reset();
+	}
+
+	BuildPlayerCell = WorldToCell(NewPlayerLocation);
+	BuildOrigin = BuildPlayerCell - FIntPoint(GridSize / 2, GridSize / 2);
+	BuildProbeZ = NewPlayerLocation.Z;
+
+	BuildCosts.Init(UnreachableCost, GridSize * GridSize);
+	BuildOpenEdges.Init(0, GridSize * GridSize);
+
+	// Breadth-first integration outward from the player's cell over linked 4-neighbours
+	BuildFrontier.Reset(GridSize * 4);
+	BuildFrontier.Add(BuildPlayerCell);
+	BuildCosts[GetCellIndex(BuildPlayerCell, BuildOrigin)] = 0;
+	BuildHead = 0;
+
+	BuildProbes = 0;
+	BuildFrames = 0;
+	BuildMs = 0.0;
+	bBuilding = true;
+}
+
+void UFlowFieldSubsystem::ContinueBuild()
+{
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!NavSys)
+	{
+		bHasField = false;
+		bBuilding = false;
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 ProbeBudget = FMath::Max(1, CVarFlowFieldProbesPerFrame.GetValueOnGameThread());
+
+	// A cell costs at most eight probes, so the budget is overshot by less than one cell
+	while (BuildHead < BuildFrontier.Num() && ProbesThisFrame < ProbeBudget)
+	{
+		const FIntPoint Cell = BuildFrontier[BuildHead++];
+		const int32 CellIndex = GetCellIndex(Cell, BuildOrigin);
+		const uint16 NextCost = BuildCosts[CellIndex] + 1;
+
+		for (int32 Neighbour = 0; Neighbour < 4; Neighbour++)
+		{
+			const FIntPoint Offset = FlowFieldNeighbours[Neighbour];
+			const int32 NextIndex = GetCellIndex(Cell + Offset, BuildOrigin);
+			if (NextIndex == INDEX_NONE || !IsEdgeOpen(*NavSys, Cell, Offset, BuildProbeZ))
+			{
+				continue;
+			}
+
+			BuildOpenEdges[CellIndex] |= EdgeBit(Offset);
+
+			if (BuildCosts[NextIndex] == UnreachableCost)
+			{
+				BuildCosts[NextIndex] = NextCost;
+				BuildFrontier.Add(Cell + Offset);
+			}
+		}
+	}
+
+	BuildFrames++;
+	BuildMs += (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	if (BuildHead < BuildFrontier.Num())
+	{
+		return;
+	}
+
+	Swap(Costs, BuildCosts);
+	Swap(OpenEdges, BuildOpenEdges);
+	GridOrigin = BuildOrigin;
+	PlayerCell = BuildPlayerCell;
+	bHasField = true;
+	bBuilding = false;
+
+	RebuildCount++;
+	ProbesLastRebuild = BuildProbes;
+	FramesLastRebuild = BuildFrames;
+	LastRebuildMs = BuildMs;
+}
+
+bool UFlowFieldSubsystem::GetFlowDirection(const FVector& Location, FVector& OutDirection) const
+{
+	LastQueryFrame.store(GFrameCounter, std::memory_order_relaxed);
+
+	if (!bHasField)
+	{
+		return false;
+	}
+
+	const FIntPoint Cell = WorldToCell(Location);
+	const int32 CellIndex = GetCellIndex(Cell, GridOrigin);
+	if (CellIndex == INDEX_NONE || Costs[CellIndex] == UnreachableCost)
+	{
+		return false;
+	}
+
+	// In the goal cell, head straight for the player
+	if (Cell == PlayerCell)
+	{
+		OutDirection = (PlayerLocation - Location).GetSafeNormal2D();
+		return !OutDirection.IsNearlyZero();
+	}
+
+	// Only step across links the navmesh raycast found clear
+	auto IsLinked = [this](int32 Index, const FIntPoint& Offset)
+	{
+		return Index != INDEX_NONE && (OpenEdges[Index] & EdgeBit(Offset)) != 0;
+	};
+
+	uint16 BestCost = Costs[CellIndex];
+	FIntPoint BestCell = Cell;
+
+	for (int32 Neighbour = 0; Neighbour < UE_ARRAY_COUNT(FlowFieldNeighbours); Neighbour++)
+	{
+		const FIntPoint Offset = FlowFieldNeighbours[Neighbour];
+		const int32 NextIndex = GetCellIndex(Cell + Offset, GridOrigin);
+		if (NextIndex == INDEX_NONE || Costs[NextIndex] >= BestCost)
+		{
+			continue;
+		}
+
+		if (Offset.X != 0 && Offset.Y != 0)
+		{
+			// Diagonals must not cut a blocked corner: both L-shaped routes have to be linked
+			const FIntPoint StepX(Offset.X, 0);
+			const FIntPoint StepY(0, Offset.Y);
+			const int32 SideX = GetCellIndex(Cell + StepX, GridOrigin);
+			const int32 SideY = GetCellIndex(Cell + StepY, GridOrigin);
+			if (!IsLinked(CellIndex, StepX) || !IsLinked(CellIndex, StepY) || !IsLinked(SideX, StepY) || !IsLinked(SideY, StepX))
+			{
+				continue;
+			}
+		}
+		else if (!IsLinked(CellIndex, Offset))
+		{
+			continue;
+		}
+
+		BestCost = Costs[NextIndex];
+		BestCell = Cell + Offset;
+	}
+
+	if (BestCell == Cell)
+	{
+		return false;
+	}
+
+	const FVector Target((BestCell.X + 0.5f) * CellSize, (BestCell.Y + 0.5f) * CellSize, Location.Z);
+	OutDirection = (Target - Location).GetSafeNormal2D();
+	return !OutDirection.IsNearlyZero();
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorld FlowFieldStatsCommand(
+	TEXT("TrinityFlow.FlowField.Stats"),
+	TEXT("Logs flow field rebuild count and cost"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UFlowFieldSubsystem* FlowField = World ? World->GetSubsystem<UFlowFieldSubsystem>() : nullptr)
+		{
+			UE_LOG(LogTemp, Log, TEXT("Flow field: %s%s, %d rebuilds, last rebuild %.3f ms over %d frames with %d navmesh probes"),
+				FlowField->HasField() ? TEXT("active") : TEXT("inactive"), FlowField->IsBuilding() ? TEXT(" (building)") : TEXT(""),
+				FlowField->GetRebuildCount(), FlowField->GetLastRebuildMs(), FlowField->GetFramesLastRebuild(),
+				FlowField->GetProbesLastRebuild());
+		}
+	}));
+#endif
@@ -0,0 +1,285 @@
+#include "AI/PathRequestScheduler.h"
+#include "Core/TrinityFlowProfiling.h"
+#include "Core/TrinityFlowLog.h"
+#include "Core/CombatEventRecorder.h"
+#include "Core/CombatReplaySubsystem.h"
+#include "AI/EnemyAIController.h"
+#include "Enemy/EnemyBase.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "NavFilters/NavigationQueryFilter.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarPathDispatchBudgetMs(
+	TEXT("TrinityFlow.Path.DispatchBudgetMs"),
+	1.0f,
+	TEXT("Game thread milliseconds per frame the path request scheduler may spend dispatching requests (async search time is not counted)"));
+
+static TAutoConsoleVariable<int32> CVarPathReplayRequestsPerFrame(
+	TEXT("TrinityFlow.Path.ReplayRequestsPerFrame"),
+	4,
+	TEXT("Requests dispatched per frame while a combat replay is recorded or played back (replaces the time budget)"));
+
+static TAutoConsoleVariable<int32> CVarPathMaxInFlight(
+	TEXT("TrinityFlow.Path.MaxInFlight"),
+	16,
+	TEXT("Maximum number of async path queries the scheduler keeps in flight"));
+
+void UPathRequestScheduler::Deinitialize()
+{
+	Queue.Empty();
+	QueueIndices.Empty();
+	InFlight.Empty();
+	InFlightQueries.Empty();
+	PathQueryDelegate.Unbind();
+
+	Super::Deinitialize();
+}
+
+TStatId UPathRequestScheduler::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPathRequestScheduler, STATGROUP_TrinityFlow);
+}
+
+void UPathRequestScheduler::RequestPath(AEnemyBase* Enemy, AActor* Goal, float AcceptanceRadius)
+{
+	if (!Enemy || !Goal)
+	{
+		return;
+	}
+
+	// Coalesce: keep the original request time so a re-request does not reset its staleness
+	if (const int32* QueueIndex = QueueIndices.Find(Enemy))
+	{
+		FPathRequest& Existing = Queue[*QueueIndex];
+		Existing.Goal = Goal;
+		Existing.AcceptanceRadius = AcceptanceRadius;
+		return;
+	}
+
+	FPathRequest& Request = Queue.AddDefaulted_GetRef();
+	Request.Enemy = Enemy;
+	Request.Key = Enemy;
+	Request.Goal = Goal;
+	Request.AcceptanceRadius = AcceptanceRadius;
+	Request.RequestTime = GetWorld()->GetTimeSeconds();
+	QueueIndices.Add(Enemy, Queue.Num() - 1);
+}
+
+void UPathRequestScheduler::CancelRequests(AEnemyBase* Enemy)
+{
+	int32 QueueIndex;
+	if (QueueIndices.RemoveAndCopyValue(Enemy, QueueIndex))
+	{
+		Queue.RemoveAtSwap(QueueIndex, 1, EAllowShrinking::No);
+		if (Queue.IsValidIndex(QueueIndex))
+		{
+			QueueIndices.Add(Queue[QueueIndex].Key, QueueIndex);
+		}
+	}
+
+	uint32 QueryId;
+	if (InFlightQueries.RemoveAndCopyValue(Enemy, QueryId))
+	{
+		InFlight.Remove(QueryId);
+	}
+}
+
+void UPathRequestScheduler::Tick(float DeltaTime)
+{
+	TRINITYFLOW_SCOPE_CYCLE_COUNTER(PathDispatch);
+
+	DispatchedLastFrame = 0;
+	DispatchMsLastFrame = 0.0;
+
+	if (Queue.Num() == 0)
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double Now = GetWorld()->GetTimeSeconds();
+	const double BudgetSeconds = CVarPathDispatchBudgetMs.GetValueOnGameThread() / 1000.0;
+	const int32 MaxInFlight = FMath::Max(1, CVarPathMaxInFlight.GetValueOnGameThread());
+
+	// Recorded runs must reproduce enemy movement frame for frame, so neither the wall clock nor
+	// async completion may decide which frame a path is applied on
+	const UCombatReplaySubsystem* Replay = UCombatReplaySubsystem::Get(this);
+	const bool bDeterministic = Replay && (Replay->IsRecording() || Replay->IsReplaying());
+	const int32 DeterministicCount = FMath::Max(1, CVarPathReplayRequestsPerFrame.GetValueOnGameThread());
+
+	// Stale requests first, then the ones closest to their goal
+	for (FPathRequest& Request : Queue)
+	{
+		const AEnemyBase* Enemy = Request.Enemy.Get();
+		const AActor* Goal = Request.Goal.Get();
+		const float Distance = Enemy && Goal ? FVector::Dist(Enemy->GetActorLocation(), Goal->GetActorLocation()) : 0.0f;
+		Request.Priority = static_cast<float>(Now - Request.RequestTime) * StalenessWeight - Distance;
+	}
+
+	Queue.Sort([](const FPathRequest& A, const FPathRequest& B) { return A.Priority > B.Priority; });
+
+	// Always dispatch at least one request so the queue cannot stall on a tiny budget. Requests that
+	// are not dispatched are compacted to the front of the queue in priority order.
+	int32 NumProcessed = 0;
+	int32 NumKept = 0;
+	for (int32 QueueIndex = 0; QueueIndex < Queue.Num(); QueueIndex++)
+	{
+		const bool bOutOfBudget = bDeterministic
+			? NumProcessed >= DeterministicCount
+			: InFlight.Num() >= MaxInFlight || (NumProcessed > 0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds);
+
+		// An enemy waits for its running query; this request goes out once that result is in
+		if (bOutOfBudget || InFlightQueries.Contains(Queue[QueueIndex].Key))
+		{
+			if (NumKept != QueueIndex)
+			{
+				Queue[NumKept] = MoveTemp(Queue[QueueIndex]);
+			}
+			NumKept++;
+			continue;
+		}
+
+		if (Dispatch(Queue[QueueIndex], bDeterministic))
+		{
+			DispatchedLastFrame++;
+			TRINITYFLOW_INC_COUNTER(PathRequests, 1);
+		}
+		NumProcessed++;
+	}
+
+	Queue.SetNum(NumKept, EAllowShrinking::No);
+
+	QueueIndices.Reset();
+	for (int32 QueueIndex = 0; QueueIndex < Queue.Num(); QueueIndex++)
+	{
+		QueueIndices.Add(Queue[QueueIndex].Key, QueueIndex);
+	}
+
+	DispatchMsLastFrame = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+}
+
+bool UPathRequestScheduler::Dispatch(const FPathRequest& Request, bool bSynchronous)
+{
+	AEnemyBase* Enemy = Request.Enemy.Get();
+	AActor* Goal = Request.Goal.Get();
+	AEnemyAIController* Controller = Enemy ? Cast<AEnemyAIController>(Enemy->GetController()) : nullptr;
+	if (!Controller || !Goal)
+	{
+		return false;
+	}
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	const FVector Start = Enemy->GetNavAgentLocation();
+	const ANavigationData* NavData = NavSys ? NavSys->GetNavDataForProps(Controller->GetNavAgentPropertiesRef(), Start) : nullptr;
+
+	if (!NavData)
+	{
+		// No navigation data to query asynchronously; fall back to the synchronous move
+		Controller->MoveToActor(Goal, Request.AcceptanceRadius);
+		RecordLatency(Request);
+		return true;
+	}
+
+	if (!PathQueryDelegate.IsBound())
+	{
+		PathQueryDelegate.BindUObject(this, &UPathRequestScheduler::OnPathFound);
+	}
+
+	FPathFindingQuery Query(Controller, *NavData, Start, Goal->GetActorLocation(),
+		UNavigationQueryFilter::GetQueryFilter(*NavData, Controller, Controller->GetDefaultNavigationFilterClass()));
+	Query.SetAllowPartialPaths(true);
+
+	if (bSynchronous)
+	{
+		const FPathFindingResult PathResult = NavSys->FindPathSync(Controller->GetNavAgentPropertiesRef(), Query, EPathFindingMode::Regular);
+		RecordLatency(Request);
+		TRINITYFLOW_RECORD_COMBAT(PathRequested, Enemy, Goal, Request.AcceptanceRadius);
+
+		if (PathResult.IsSuccessful() && PathResult.Path.IsValid())
+		{
+			ApplyPath(Request, Controller, PathResult.Path);
+		}
+		return true;
+	}
+
+	const uint32 QueryId = NavSys->FindPathAsync(Controller->GetNavAgentPropertiesRef(), Query, PathQueryDelegate, EPathFindingMode::Regular);
+	if (QueryId == INVALID_NAVQUERYID)
+	{
+		return false;
+	}
+
+	InFlight.Add(QueryId, Request);
+	InFlightQueries.Add(Request.Key, QueryId);
+	TRINITYFLOW_RECORD_COMBAT(PathRequested, Enemy, Goal, Request.AcceptanceRadius);
+	return true;
+}
+
+void UPathRequestScheduler::OnPathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path)
+{
+	TRINITYFLOW_SCOPE_CYCLE_COUNTER(PathApply);
+
+	FPathRequest Request;
+	if (!InFlight.RemoveAndCopyValue(QueryId, Request))
+	{
+		// Cancelled while the query was running
+		return;
+	}
+
+	InFlightQueries.Remove(Request.Key);
+
+	RecordLatency(Request);
+	TRINITYFLOW_RECORD_COMBAT(PathCompleted, Request.Enemy.Get(), Request.Goal.Get(),
+		static_cast<float>((GetWorld()->GetTimeSeconds() - Request.RequestTime) * 1000.0), 0.0f, static_cast<uint8>(Result));
+
+	AEnemyBase* Enemy = Request.Enemy.Get();
+	AEnemyAIController* Controller = Enemy ? Cast<AEnemyAIController>(Enemy->GetController()) : nullptr;
+	if (!Controller || !Request.Goal.IsValid())
+	{
+		return;
+	}
+
+	if (Result != ENavigationQueryResult::Success || !Path.IsValid())
+	{
+		UE_LOG(LogTrinityFlowAI, Verbose, TEXT("PathRequestScheduler: No path for %s"), *Enemy->GetName());
+		return;
+	}
+
+	ApplyPath(Request, Controller, Path);
+}
+
+void UPathRequestScheduler::ApplyPath(const FPathRequest& Request, AEnemyAIController* Controller, FNavPathSharedPtr Path)
+{
+	AActor* Goal = Request.Goal.Get();
+
+	FAIMoveRequest MoveRequest(Goal);
+	MoveRequest.SetAcceptanceRadius(Request.AcceptanceRadius);
+
+	// Keep following a moving goal and repath when the navmesh changes
+	Path->SetGoalActorObservation(*Goal, 100.0f);
+	Path->EnableRecalculationOnInvalidation(true);
+
+	Controller->RequestMove(MoveRequest, Path);
+}
+
+void UPathRequestScheduler::RecordLatency(const FPathRequest& Request)
+{
+	const double LatencyMs = (GetWorld()->GetTimeSeconds() - Request.RequestTime) * 1000.0;
+	AverageLatencyMs = AverageLatencyMs > 0.0 ? FMath::Lerp(AverageLatencyMs, LatencyMs, 0.1) : LatencyMs;
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorld PathStatsCommand(
+	TEXT("TrinityFlow.Path.Stats"),
+	TEXT("Logs queue depth, latency and per-frame cost of the path request scheduler"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UPathRequestScheduler* Scheduler = World ? World->GetSubsystem<UPathRequestScheduler>() : nullptr)
+		{
+			UE_LOG(LogTemp, Log, TEXT("Path scheduler: %d queued, %d in flight, %d dispatched in %.3f game thread ms last frame, %.1f ms average latency"),
+				Scheduler->GetQueueDepth(), Scheduler->GetNumInFlight(), Scheduler->GetDispatchedLastFrame(),
+				Scheduler->GetDispatchMsLastFrame(), Scheduler->GetAverageLatencyMs());
+		}
+	}));
+#endif
@@ -1,8 +1,10 @@
 #include "AI/States/AIState_Attack.h"
+#include "Core/TrinityFlowProfiling.h"
 #include "Enemy/EnemyBase.h"
 #include "AI/EnemyAIController.h"
 #include "Core/CombatComponent.h"
 #include "Core/StateComponent.h"
+#include "Core/CombatantHandleSubsystem.h"
 #include "Core/TrinityFlowTypes.h"
 #include "Enemy/EnemyAnimationComponent.h"
 #include "DrawDebugHelpers.h"
@@ -35,57 +37,62 @@ void UAIState_Attack::Enter(AEnemyBase* Enemy, AEnemyAIController* AIController)
 	}
 }
 
-void UAIState_Attack::Update(float DeltaTime)
+void UAIState_Attack::Evaluate(const FAIStateSnapshot& Snapshot, FAIStateDecision& OutDecision)
 {
-	Super::Update(DeltaTime);
+	TRINITYFLOW_SCOPE_CYCLE_COUNTER(AIAttack);
 
-	if (!CachedEnemy || !CachedAIController)
+	if (!Snapshot.Target)
 	{
+		OutDecision.NextState = IdleStateClass;
 		return;
 	}
 
-	APawn* Target = CachedEnemy->GetTargetPlayer();
-	if (!Target)
+	const float AttackRange = FMath::Min(Snapshot.AttackRange, MaxAttackRange);
+	if (FVector::DistSquared(Snapshot.EnemyLocation, Snapshot.TargetLocation) > FMath::Square(AttackRange))
 	{
-		if (IdleStateClass)
-		{
-			TransitionToState(IdleStateClass);
-		}
+		OutDecision.NextState = ChaseStateClass;
 		return;
 	}
 
-	if (!IsTargetInRange())
+	OutDecision.bFaceTarget = true;
+
+	if (!bIsAttacking && Snapshot.bCanAttack)
+	{
+		OutDecision.bAttack = true;
+		bIsAttacking = true;
+		TimeSinceLastAttack = 0.0f;
+	}
+	else if (bIsAttacking)
 	{
-		if (ChaseStateClass)
+		TimeSinceLastAttack += Snapshot.DeltaTime;
+		
+		if (TimeSinceLastAttack >= AttackCooldown)
 		{
-			TransitionToState(ChaseStateClass);
+			bIsAttacking = false;
 		}
-		return;
 	}
+}
 
-	CachedEnemy->FaceTarget(Target);
+void UAIState_Attack::Apply(const FAIStateSnapshot& Snapshot, const FAIStateDecision& Decision)
+{
+	TRINITYFLOW_SCOPE_CYCLE_COUNTER(AIAttack);
 
-	UCombatComponent* CombatComp = CachedEnemy->GetCombatComponent();
-	if (!CombatComp)
+	if (!CachedEnemy || !CachedAIController)
 	{
 		return;
 	}
 
-	if (!bIsAttacking && CombatComp->CanAttack())
+	if (Decision.bFaceTarget)
 	{
-		PerformAttack();
-		bIsAttacking = true;
-		TimeSinceLastAttack = 0.0f;
+		CachedEnemy->FaceTarget(Snapshot.Target);
 	}
-	else if (bIsAttacking)
+
+	if (Decision.bAttack)
 	{
-		TimeSinceLastAttack += DeltaTime;
-		
-		if (TimeSinceLastAttack >= AttackCooldown)
-		{
-			bIsAttacking = false;
-		}
+		PerformAttack();
 	}
+
+	Super::Apply(Snapshot, Decision);
 }
 
 void UAIState_Attack::Exit()
@@ -103,7 +110,7 @@ void UAIState_Attack::PerformAttack()
 	}
 
 	// Play attack animation
-	if (UEnemyAnimationComponent* AnimComp = CachedEnemy->FindComponentByClass<UEnemyAnimationComponent>())
+	if (UEnemyAnimationComponent* AnimComp = UCombatantHandleSubsystem::Get(CachedEnemy).EnemyAnimation.Get())
 	{
 		AnimComp->PlayAttackAnimation();
 	}
@@ -134,22 +141,3 @@ void UAIState_Attack::PerformAttack()
 	#endif
 #endif
 }
-
-bool UAIState_Attack::IsTargetInRange()
-{
-	if (!CachedEnemy)
-	{
-		return false;
-	}
-
-	APawn* Target = CachedEnemy->GetTargetPlayer();
-	if (!Target)
-	{
-		return false;
-	}
-
-	float Distance = FVector::Dist(CachedEnemy->GetActorLocation(), Target->GetActorLocation());
-	float AttackRange = FMath::Min(CachedEnemy->GetAttackRange(), MaxAttackRange);
-	
-	return Distance <= AttackRange;
-}
\ No newline at end of file
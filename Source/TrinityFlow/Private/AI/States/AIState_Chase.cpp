@@ -1,15 +1,18 @@
 #include "AI/States/AIState_Chase.h"
+#include "Core/TrinityFlowProfiling.h"
+#include "Core/TrinityFlowLog.h"
 #include "Enemy/EnemyBase.h"
 #include "AI/EnemyAIController.h"
+#include "AI/EnemyPerceptionSubsystem.h"
+#include "AI/PathRequestScheduler.h"
+#include "AI/FlowFieldSubsystem.h"
 #include "Core/StateComponent.h"
 #include "Core/TrinityFlowTypes.h"
 #include "Core/CombatStateManager.h"
-#include "NavigationSystem.h"
 #include "Navigation/PathFollowingComponent.h"
 #include "AITypes.h"
 #include "GameFramework/PawnMovementComponent.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
 
 UAIState_Chase::UAIState_Chase()
 {
@@ -24,7 +27,7 @@ void UAIState_Chase::Enter(AEnemyBase* Enemy, AEnemyAIController* AIController)
 	Super::Enter(Enemy, AIController);
 	
 	TimeSinceLastPathUpdate = 0.0f;
-	
+	bFollowingFlowField = false;
 	
 	if (CachedEnemy && CachedEnemy->GetStateComponent())
 	{
@@ -41,40 +44,91 @@ void UAIState_Chase::Enter(AEnemyBase* Enemy, AEnemyAIController* AIController)
 		}
 	}
 	
-	UpdatePath();
+	// Enemies inside the flow field start steering on their first update
+	FVector FlowDirection;
+	if (!SampleFlowField(FlowDirection))
+	{
+		UpdatePath();
+	}
 }
 
-void UAIState_Chase::Update(float DeltaTime)
+void UAIState_Chase::Evaluate(const FAIStateSnapshot& Snapshot, FAIStateDecision& OutDecision)
 {
-	Super::Update(DeltaTime);
+	TRINITYFLOW_SCOPE_CYCLE_COUNTER(AIChase);
 
-	if (!CachedEnemy || !CachedAIController)
+	if (!Snapshot.Target)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Chase State: No enemy or controller"));
+		OutDecision.NextState = IdleStateClass;
 		return;
 	}
 
-	APawn* Target = CachedEnemy->GetTargetPlayer();
-	if (!Target)
+	// Too far, or the shared line of sight is blocked (an unknown result keeps chasing)
+	const float Distance = FVector::Dist(Snapshot.EnemyLocation, Snapshot.TargetLocation);
+	if (Distance > LostTargetDistance || Snapshot.Visibility == EEnemyVisibility::Blocked)
 	{
-		if (IdleStateClass)
+		OutDecision.bClearTarget = true;
+		OutDecision.NextState = IdleStateClass;
+		return;
+	}
+
+	if (Distance <= Snapshot.AttackRange)
+	{
+		OutDecision.NextState = AttackStateClass;
+		return;
+	}
+
+	OutDecision.bFaceTarget = true;
+
+	// Inside the flow field's coverage, steer along it; the navmesh path is only a fallback
+	FVector FlowDirection;
+	if (Snapshot.FlowField && Snapshot.FlowField->GetFlowDirection(Snapshot.EnemyLocation, FlowDirection))
+	{
+		if (!bFollowingFlowField)
 		{
-			TransitionToState(IdleStateClass);
+			bFollowingFlowField = true;
+			OutDecision.bStopPathFollowing = true;
 		}
+
+		OutDecision.MoveInput = FlowDirection;
 		return;
 	}
-	
+
+	// Left the field: request a path right away
+	if (bFollowingFlowField)
+	{
+		bFollowingFlowField = false;
+		TimeSinceLastPathUpdate = PathUpdateInterval;
+	}
+
+	TimeSinceLastPathUpdate += Snapshot.DeltaTime;
+	if (TimeSinceLastPathUpdate >= PathUpdateInterval)
+	{
+		TimeSinceLastPathUpdate = 0.0f;
+		OutDecision.bRefreshPath = true;
+	}
+}
+
+void UAIState_Chase::Apply(const FAIStateSnapshot& Snapshot, const FAIStateDecision& Decision)
+{
+	TRINITYFLOW_SCOPE_CYCLE_COUNTER(AIChase);
+
+	if (!CachedEnemy || !CachedAIController)
+	{
+		UE_LOG(LogTrinityFlowAI, Warning, TEXT("Chase State: No enemy or controller"));
+		return;
+	}
+
 	// Check movement component status
 	if (UPawnMovementComponent* MoveComp = CachedEnemy->GetMovementComponent())
 	{
 		FVector Velocity = MoveComp->Velocity;
-		if (Velocity.SizeSquared() < 1.0f)
+		if (Snapshot.Target && Velocity.SizeSquared() < 1.0f)
 		{
 			static int32 StuckCounter = 0;
 			StuckCounter++;
 			if (StuckCounter % 60 == 0) // Log every second if stuck
 			{
-				UE_LOG(LogTemp, Warning, TEXT("Enemy %s appears stuck! Velocity: %s, MaxSpeed: %.1f"), 
+				UE_LOG(LogTrinityFlowAI, Verbose, TEXT("Enemy %s appears stuck! Velocity: %s, MaxSpeed: %.1f"), 
 					*CachedEnemy->GetName(), 
 					*Velocity.ToString(),
 					MoveComp->GetMaxSpeed());
@@ -82,39 +136,48 @@ void UAIState_Chase::Update(float DeltaTime)
 		}
 	}
 
-	if (HasLostTarget())
+	if (Decision.bClearTarget)
 	{
+		UE_LOG(LogTrinityFlowAI, Verbose, TEXT("Chase State: %s lost its target"), *CachedEnemy->GetName());
 		CachedEnemy->SetTargetPlayer(nullptr);
-		if (IdleStateClass)
-		{
-			TransitionToState(IdleStateClass);
-		}
-		return;
 	}
 
-	if (IsInAttackRange())
+	if (Decision.bFaceTarget)
 	{
-		if (AttackStateClass)
+		CachedEnemy->FaceTarget(Snapshot.Target);
+	}
+
+	if (Decision.bStopPathFollowing)
+	{
+		if (UPathRequestScheduler* Scheduler = CachedEnemy->GetWorld()->GetSubsystem<UPathRequestScheduler>())
 		{
-			TransitionToState(AttackStateClass);
+			Scheduler->CancelRequests(CachedEnemy);
 		}
-		return;
+		CachedAIController->StopMovement();
 	}
 
-	CachedEnemy->FaceTarget(Target);
+	if (!Decision.MoveInput.IsZero())
+	{
+		CachedEnemy->AddMovementInput(Decision.MoveInput);
+	}
 
-	TimeSinceLastPathUpdate += DeltaTime;
-	if (TimeSinceLastPathUpdate >= PathUpdateInterval)
+	if (Decision.bRefreshPath)
 	{
-		TimeSinceLastPathUpdate = 0.0f;
 		UpdatePath();
 	}
+
+	Super::Apply(Snapshot, Decision);
 }
 
 void UAIState_Chase::Exit()
 {
 	Super::Exit();
 	
+	if (UPathRequestScheduler* Scheduler = CachedEnemy ? CachedEnemy->GetWorld()->GetSubsystem<UPathRequestScheduler>() : nullptr)
+	{
+		Scheduler->CancelRequests(CachedEnemy);
+	}
+	
 	if (CachedAIController)
 	{
 		CachedAIController->StopMovement();
@@ -125,14 +188,14 @@ void UAIState_Chase::UpdatePath()
 {
 	if (!CachedAIController || !CachedEnemy)
 	{
-		UE_LOG(LogTemp, Error, TEXT("UpdatePath: No controller or enemy"));
+		UE_LOG(LogTrinityFlowAI, Error, TEXT("UpdatePath: No controller or enemy"));
 		return;
 	}
 	
 	// Double-check controller is valid and matches
 	if (CachedEnemy->GetController() != CachedAIController)
 	{
-		UE_LOG(LogTemp, Error, TEXT("UpdatePath: Controller mismatch! Enemy controller = %s, Cached = %s"),
+		UE_LOG(LogTrinityFlowAI, Warning, TEXT("UpdatePath: Controller mismatch! Enemy controller = %s, Cached = %s"),
 			CachedEnemy->GetController() ? *CachedEnemy->GetController()->GetName() : TEXT("NULL"),
 			CachedAIController ? *CachedAIController->GetName() : TEXT("NULL"));
 		
@@ -143,167 +206,25 @@ void UAIState_Chase::UpdatePath()
 	APawn* Target = CachedEnemy->GetTargetPlayer();
 	if (!Target)
 	{
-		UE_LOG(LogTemp, Error, TEXT("UpdatePath: No target"));
+		UE_LOG(LogTrinityFlowAI, Verbose, TEXT("UpdatePath: No target"));
 		return;
 	}
 
-	// Check nav system
-	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(CachedEnemy->GetWorld());
-	if (!NavSys)
+	// Pathfinding is queued and budgeted across all chasing enemies
+	if (UPathRequestScheduler* Scheduler = CachedEnemy->GetWorld()->GetSubsystem<UPathRequestScheduler>())
 	{
-		UE_LOG(LogTemp, Error, TEXT("UpdatePath: No Navigation System!"));
+		Scheduler->RequestPath(CachedEnemy, Target, AcceptanceRadius);
 		return;
 	}
 
-	// Check if location is on nav mesh
-	FNavLocation NavLocation;
-	bool bOnNavMesh = NavSys->ProjectPointToNavigation(CachedEnemy->GetActorLocation(), NavLocation, FVector(500, 500, 500));
-	
-	if (!bOnNavMesh)
-	{
-		UE_LOG(LogTemp, Error, TEXT("UpdatePath: Enemy %s is NOT on NavMesh! Location: %s"), 
-			*CachedEnemy->GetName(), *CachedEnemy->GetActorLocation().ToString());
-	}
-	else
+	if (CachedAIController && CachedAIController->MoveToActor(Target, AcceptanceRadius) == EPathFollowingRequestResult::Failed)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UpdatePath: Enemy %s IS on NavMesh. Enemy Loc: %s, Nav Loc: %s"), 
-			*CachedEnemy->GetName(), 
-			*CachedEnemy->GetActorLocation().ToString(),
-			*NavLocation.Location.ToString());
+		UE_LOG(LogTrinityFlowAI, Verbose, TEXT("UpdatePath: MoveTo FAILED for %s"), *CachedEnemy->GetName());
 	}
-	
-	// Check if target is on nav mesh
-	FNavLocation TargetNavLocation;
-	bool bTargetOnNavMesh = NavSys->ProjectPointToNavigation(Target->GetActorLocation(), TargetNavLocation, FVector(500, 500, 500));
-	
-	if (!bTargetOnNavMesh)
-	{
-		UE_LOG(LogTemp, Error, TEXT("UpdatePath: Target is NOT on NavMesh! Location: %s"), 
-			*Target->GetActorLocation().ToString());
-	}
-
-	// Try SimpleMoveToActor first - it's more forgiving
-	EPathFollowingRequestResult::Type SimpleResult = CachedAIController->MoveToActor(Target, AcceptanceRadius);
-	
-	// Log result
-	switch (SimpleResult)
-	{
-		case EPathFollowingRequestResult::Failed:
-			{
-				UE_LOG(LogTemp, Error, TEXT("UpdatePath: MoveTo FAILED for %s"), *CachedEnemy->GetName());
-				
-				// Additional debugging for failure
-				if (!CachedAIController->GetPathFollowingComponent())
-				{
-					UE_LOG(LogTemp, Error, TEXT("  - Reason: NO PathFollowingComponent!"));
-				}
-				else if (!CachedEnemy->GetMovementComponent())
-				{
-					UE_LOG(LogTemp, Error, TEXT("  - Reason: NO MovementComponent!"));
-				}
-				else
-				{
-					UE_LOG(LogTemp, Error, TEXT("  - PathFollowing: %s, Movement: %s"), 
-						*CachedAIController->GetPathFollowingComponent()->GetClass()->GetName(),
-						*CachedEnemy->GetMovementComponent()->GetClass()->GetName());
-					
-					// Check if movement component is properly linked
-					if (CachedAIController->GetPawn() != CachedEnemy)
-					{
-						UE_LOG(LogTemp, Error, TEXT("  - Controller pawn mismatch! Controller's pawn: %s"), 
-							CachedAIController->GetPawn() ? *CachedAIController->GetPawn()->GetName() : TEXT("NULL"));
-					}
-					
-				}
-			}
-			break;
-		case EPathFollowingRequestResult::AlreadyAtGoal:
-			UE_LOG(LogTemp, Warning, TEXT("UpdatePath: %s is already at goal"), *CachedEnemy->GetName());
-			break;
-		case EPathFollowingRequestResult::RequestSuccessful:
-			UE_LOG(LogTemp, Log, TEXT("UpdatePath: MoveTo successful for %s"), *CachedEnemy->GetName());
-			break;
-	}
-	
-
-#if !UE_BUILD_SHIPPING
-	#if WITH_EDITOR
-	if (CachedEnemy->GetWorld()->WorldType == EWorldType::Editor)
-	{
-		DrawDebugSphere(CachedEnemy->GetWorld(), Target->GetActorLocation(), 
-			AcceptanceRadius, 12, FColor::Yellow, false, PathUpdateInterval);
-		
-		// Draw path if it exists
-		if (SimpleResult == EPathFollowingRequestResult::RequestSuccessful)
-		{
-			DrawDebugLine(CachedEnemy->GetWorld(), CachedEnemy->GetActorLocation(), 
-				Target->GetActorLocation(), FColor::Green, false, PathUpdateInterval, 0, 5.0f);
-		}
-	}
-	#endif
-#endif
 }
 
-bool UAIState_Chase::IsInAttackRange()
+bool UAIState_Chase::SampleFlowField(FVector& OutDirection) const
 {
-	if (!CachedEnemy)
-	{
-		return false;
-	}
-
-	APawn* Target = CachedEnemy->GetTargetPlayer();
-	if (!Target)
-	{
-		return false;
-	}
-
-	float Distance = FVector::Dist(CachedEnemy->GetActorLocation(), Target->GetActorLocation());
-	return Distance <= CachedEnemy->GetAttackRange();
+	const UFlowFieldSubsystem* FlowField = CachedEnemy ? CachedEnemy->GetWorld()->GetSubsystem<UFlowFieldSubsystem>() : nullptr;
+	return FlowField && FlowField->GetFlowDirection(CachedEnemy->GetActorLocation(), OutDirection);
 }
-
-bool UAIState_Chase::HasLostTarget()
-{
-	if (!CachedEnemy)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("HasLostTarget: No enemy"));
-		return true;
-	}
-
-	APawn* Target = CachedEnemy->GetTargetPlayer();
-	if (!Target)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("HasLostTarget: No target"));
-		return true;
-	}
-
-	float Distance = FVector::Dist(CachedEnemy->GetActorLocation(), Target->GetActorLocation());
-	
-	if (Distance > LostTargetDistance)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("HasLostTarget: Distance %.0f > LostTargetDistance %.0f"), Distance, LostTargetDistance);
-		return true;
-	}
-
-	FVector StartLocation = CachedEnemy->GetActorLocation() + FVector(0, 0, 50);
-	FVector EndLocation = Target->GetActorLocation() + FVector(0, 0, 50);
-	
-	FHitResult HitResult;
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(CachedEnemy);
-	
-	bool bHit = CachedEnemy->GetWorld()->LineTraceSingleByChannel(
-		HitResult,
-		StartLocation,
-		EndLocation,
-		ECC_Visibility,
-		QueryParams
-	);
-
-	bool bCanSeeTarget = !bHit || HitResult.GetActor() == Target;
-	if (!bCanSeeTarget)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("HasLostTarget: Line of sight blocked"));
-	}
-	
-	return !bCanSeeTarget;
-}
\ No newline at end of file
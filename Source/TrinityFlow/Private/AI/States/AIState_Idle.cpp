@@ -1,10 +1,10 @@
 #include "AI/States/AIState_Idle.h"
+#include "Core/TrinityFlowProfiling.h"
 #include "Enemy/EnemyBase.h"
 #include "AI/EnemyAIController.h"
+#include "AI/EnemyPerceptionSubsystem.h"
 #include "Core/StateComponent.h"
 #include "Core/TrinityFlowTypes.h"
-#include "GameFramework/PlayerController.h"
-#include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
 
@@ -29,101 +29,72 @@ void UAIState_Idle::Enter(AEnemyBase* Enemy, AEnemyAIController* AIController)
 	}
 }
 
-void UAIState_Idle::Update(float DeltaTime)
+void UAIState_Idle::Evaluate(const FAIStateSnapshot& Snapshot, FAIStateDecision& OutDecision)
 {
-	Super::Update(DeltaTime);
+	TRINITYFLOW_SCOPE_CYCLE_COUNTER(AIIdle);
 
-	if (!CachedEnemy || !CachedAIController)
+	bDetectionCheckInRange = false;
+
+	TimeSinceLastCheck += Snapshot.DeltaTime;
+	if (TimeSinceLastCheck < DetectionCheckInterval)
 	{
 		return;
 	}
 
-	TimeSinceLastCheck += DeltaTime;
-	
-	if (TimeSinceLastCheck >= DetectionCheckInterval)
+	TimeSinceLastCheck = 0.0f;
+
+	if (!Snapshot.Player || FVector::DistSquared(Snapshot.EnemyLocation, Snapshot.PlayerLocation) > FMath::Square(Snapshot.SightRange))
 	{
-		TimeSinceLastCheck = 0.0f;
-		
-		if (CheckForPlayer())
-		{
-			if (ChaseStateClass)
-			{
-				TransitionToState(ChaseStateClass);
-			}
-			else
-			{
-				UE_LOG(LogTemp, Error, TEXT("Idle State: No ChaseStateClass set!"));
-			}
-		}
+		return;
 	}
-}
 
-void UAIState_Idle::Exit()
-{
-	Super::Exit();
-}
+	bDetectionCheckInRange = true;
 
-bool UAIState_Idle::CheckForPlayer()
-{
-	if (!CachedEnemy)
+	// Line of sight is traced asynchronously by the perception subsystem and cached in the snapshot
+	if (Snapshot.Visibility == EEnemyVisibility::Visible)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("CheckForPlayer: No CachedEnemy"));
-		return false;
+		OutDecision.bAcquirePlayer = true;
+		OutDecision.NextState = ChaseStateClass;
 	}
+}
 
-	APlayerController* PlayerController = UGameplayStatics::GetPlayerController(CachedEnemy->GetWorld(), 0);
-	if (!PlayerController)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("CheckForPlayer: No PlayerController"));
-		return false;
-	}
+void UAIState_Idle::Apply(const FAIStateSnapshot& Snapshot, const FAIStateDecision& Decision)
+{
+	TRINITYFLOW_SCOPE_CYCLE_COUNTER(AIIdle);
 
-	APawn* PlayerPawn = PlayerController->GetPawn();
-	if (!PlayerPawn)
+	if (!CachedEnemy || !CachedAIController)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("CheckForPlayer: No PlayerPawn"));
-		return false;
+		return;
 	}
 
-	float DistanceToPlayer = FVector::Dist(CachedEnemy->GetActorLocation(), PlayerPawn->GetActorLocation());
-	float SightRange = CachedEnemy->GetSightRange();
-	
-	if (DistanceToPlayer <= SightRange)
-	{
-		FVector StartLocation = CachedEnemy->GetActorLocation() + FVector(0, 0, 50);
-		FVector EndLocation = PlayerPawn->GetActorLocation() + FVector(0, 0, 50);
-		
-		FHitResult HitResult;
-		FCollisionQueryParams QueryParams;
-		QueryParams.AddIgnoredActor(CachedEnemy);
-		
-		bool bHit = CachedEnemy->GetWorld()->LineTraceSingleByChannel(
-			HitResult,
-			StartLocation,
-			EndLocation,
-			ECC_Visibility,
-			QueryParams
-		);
-
 #if !UE_BUILD_SHIPPING
+	if (bDetectionCheckInRange)
+	{
+		FVector StartLocation = Snapshot.EnemyLocation + FVector(0, 0, UEnemyPerceptionSubsystem::EyeHeight);
+		FVector EndLocation = Snapshot.PlayerLocation + FVector(0, 0, UEnemyPerceptionSubsystem::EyeHeight);
 		DrawDebugLine(CachedEnemy->GetWorld(), StartLocation, EndLocation, 
-			!bHit || HitResult.GetActor() == PlayerPawn ? FColor::Green : FColor::Red, 
+			Snapshot.Visibility == EEnemyVisibility::Visible ? FColor::Green : FColor::Red, 
 			false, 0.5f);
 		
-		DrawDebugSphere(CachedEnemy->GetWorld(), CachedEnemy->GetActorLocation(), SightRange, 24, FColor::Yellow, false, 0.5f);
+		DrawDebugSphere(CachedEnemy->GetWorld(), Snapshot.EnemyLocation, Snapshot.SightRange, 24, FColor::Yellow, false, 0.5f);
+	}
 #endif
 
-		if (!bHit || HitResult.GetActor() == PlayerPawn)
-		{
-			CachedEnemy->SetTargetPlayer(PlayerPawn);
-			CachedEnemy->bHasSeenPlayer = true;  // Set the flag
-			return true;
-		}
-		else
+	if (Decision.bAcquirePlayer)
+	{
+		CachedEnemy->SetTargetPlayer(Snapshot.Player);
+		CachedEnemy->bHasSeenPlayer = true;
+
+		if (!ChaseStateClass)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("CheckForPlayer: Player blocked by %s"), HitResult.GetActor() ? *HitResult.GetActor()->GetName() : TEXT("Unknown"));
+			UE_LOG(LogTemp, Error, TEXT("Idle State: No ChaseStateClass set!"));
 		}
 	}
 
-	return false;
-}
\ No newline at end of file
+	Super::Apply(Snapshot, Decision);
+}
+
+void UAIState_Idle::Exit()
+{
+	Super::Exit();
+}
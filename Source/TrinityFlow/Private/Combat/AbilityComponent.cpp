@@ -1,54 +1,49 @@
 #include "Combat/AbilityComponent.h"
 #include "Core/HealthComponent.h"
-#include "Core/StateComponent.h"
+#include "Core/CombatantHandleSubsystem.h"
+#include "Core/StatusEffectSubsystem.h"
+#include "Core/CombatEventRecorder.h"
+#include "Core/TrinityFlowLog.h"
 #include "DrawDebugHelpers.h"
 
 UAbilityComponent::UAbilityComponent()
 {
-    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bCanEverTick = false;
 }
 
-void UAbilityComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+bool UAbilityComponent::IsEchoesMarkActive() const
 {
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    const UStatusEffectSubsystem* Effects = UStatusEffectSubsystem::Get(this);
+    return Effects && EchoesData.MarkedEnemy && Effects->HasEffect(EchoesData.MarkedEnemy, EStatusEffect::Marked);
+}
 
-    // Update Echoes of Data timer
-    if (EchoesData.MarkedEnemy && EchoesData.RemainingTime > 0.0f)
-    {
-        EchoesData.RemainingTime -= DeltaTime;
-        
-        if (EchoesData.RemainingTime <= 0.0f)
-        {
-            // Remove marked state
-            if (UStateComponent* StateComp = EchoesData.MarkedEnemy->FindComponentByClass<UStateComponent>())
-            {
-                StateComp->RemoveState(ECharacterState::Marked);
-            }
-            EchoesData.MarkedEnemy = nullptr;
-        }
-    }
+AActor* UAbilityComponent::GetEchoesTarget() const
+{
+    return IsEchoesMarkActive() ? EchoesData.MarkedEnemy : nullptr;
+}
+
+float UAbilityComponent::GetEchoesTimeRemaining() const
+{
+    const UStatusEffectSubsystem* Effects = UStatusEffectSubsystem::Get(this);
+    return Effects && EchoesData.MarkedEnemy ? Effects->GetTimeRemaining(EchoesData.MarkedEnemy, EStatusEffect::Marked) : 0.0f;
 }
 
 void UAbilityComponent::SetEchoesTarget(AActor* Target)
 {
+    UStatusEffectSubsystem* Effects = UStatusEffectSubsystem::Get(this);
+
     // Clear previous target
-    if (EchoesData.MarkedEnemy)
+    if (EchoesData.MarkedEnemy && Effects)
     {
-        if (UStateComponent* StateComp = EchoesData.MarkedEnemy->FindComponentByClass<UStateComponent>())
-        {
-            StateComp->RemoveState(ECharacterState::Marked);
-        }
+        Effects->RemoveEffect(EchoesData.MarkedEnemy, EStatusEffect::Marked);
     }
 
     EchoesData.MarkedEnemy = Target;
-    EchoesData.RemainingTime = 5.0f;
 
-    if (Target)
+    // The status effect row sets the Marked state and is the only expiry of the mark
+    if (Target && Effects)
     {
-        if (UStateComponent* StateComp = Target->FindComponentByClass<UStateComponent>())
-        {
-            StateComp->SetMarked(5.0f);
-        }
+        Effects->ApplyEffect(Target, EStatusEffect::Marked, EchoesMarkDuration);
     }
 }
 
@@ -69,19 +64,25 @@ void UAbilityComponent::OnActualDamageDealt(AActor* DamagedActor, float ActualDa
 
 void UAbilityComponent::ProcessEchoesDamageActual(AActor* DamagedActor, float ActualDamage, AActor* DamageInstigator)
 {
-    UE_LOG(LogTemp, Warning, TEXT("ProcessEchoesDamageActual: DamagedActor=%s, Damage=%.1f, MarkedEnemy=%s"), 
+    UE_LOG(LogTrinityFlowCombat, VeryVerbose, TEXT("ProcessEchoesDamageActual: DamagedActor=%s, Damage=%.1f, MarkedEnemy=%s"), 
         DamagedActor ? *DamagedActor->GetName() : TEXT("NULL"),
         ActualDamage,
         EchoesData.MarkedEnemy ? *EchoesData.MarkedEnemy->GetName() : TEXT("NULL"));
     
+    // The mark expired (or its target left play) since the last hit
+    if (EchoesData.MarkedEnemy && !IsEchoesMarkActive())
+    {
+        EchoesData.MarkedEnemy = nullptr;
+    }
+
     if (!EchoesData.MarkedEnemy || EchoesData.MarkedEnemy == DamagedActor)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Echo skipped: No marked enemy or damaged actor is the marked enemy"));
+        UE_LOG(LogTrinityFlowCombat, VeryVerbose, TEXT("Echo skipped: No marked enemy or damaged actor is the marked enemy"));
         return;
     }
 
     // Check if marked enemy is still alive
-    if (UHealthComponent* MarkedHealth = EchoesData.MarkedEnemy->FindComponentByClass<UHealthComponent>())
+    if (UHealthComponent* MarkedHealth = UCombatantHandleSubsystem::Get(EchoesData.MarkedEnemy).Health.Get())
     {
         if (!MarkedHealth->IsAlive())
         {
@@ -99,8 +100,9 @@ void UAbilityComponent::ProcessEchoesDamageActual(AActor* DamagedActor, float Ac
         // to get the desired final damage amount
         float AdjustedEchoDamage = EchoDamageAmount / 2.0f;
         
-        UE_LOG(LogTemp, Warning, TEXT("Echo calculation: ActualDamage=%.1f, 75%%=%.1f, Adjusted for soul=%.1f"), 
+        UE_LOG(LogTrinityFlowCombat, Verbose, TEXT("Echo calculation: ActualDamage=%.1f, 75%%=%.1f, Adjusted for soul=%.1f"), 
             ActualDamage, EchoDamageAmount, AdjustedEchoDamage);
+        TRINITYFLOW_RECORD_COMBAT(EchoDamage, DamageInstigator, EchoesData.MarkedEnemy, AdjustedEchoDamage, ActualDamage);
 
         // Echo damage is always Soul type
         FDamageInfo EchoDamage;
@@ -1,6 +1,10 @@
 #include "Combat/WeaponBase.h"
+#include "AI/EnemyHordeSubsystem.h"
 #include "Core/HealthComponent.h"
-#include "Core/ShardComponent.h"
+#include "Core/CombatantHandleSubsystem.h"
+#include "Core/CombatAttributeSubsystem.h"
+#include "Core/CombatEventRecorder.h"
+#include "Core/TrinityFlowLog.h"
 #include "Components/SceneComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "GameFramework/Pawn.h"
@@ -10,7 +14,7 @@
 
 AWeaponBase::AWeaponBase()
 {
-    PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bCanEverTick = false;
 
     Root = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
     SetRootComponent(Root);
@@ -37,26 +41,40 @@ void AWeaponBase::BeginPlay()
     }
 }
 
-void AWeaponBase::Tick(float DeltaTime)
+bool AWeaponBase::IsAbilityQReady() const
 {
-    Super::Tick(DeltaTime);
+    const UCombatTimerSubsystem* Timers = UCombatTimerSubsystem::Get(this);
+    return !(Timers && Timers->IsTimerActive(AbilityQCooldownHandle));
+}
 
-    // Update cooldowns
-    if (AbilityQCooldownTimer > 0.0f)
-    {
-        AbilityQCooldownTimer -= DeltaTime;
-    }
+bool AWeaponBase::IsAbilityEReady() const
+{
+    const UCombatTimerSubsystem* Timers = UCombatTimerSubsystem::Get(this);
+    return !(Timers && Timers->IsTimerActive(AbilityECooldownHandle));
+}
 
-    if (AbilityECooldownTimer > 0.0f)
-    {
-        AbilityECooldownTimer -= DeltaTime;
-    }
+float AWeaponBase::GetAbilityQCooldownRemaining() const
+{
+    const UCombatTimerSubsystem* Timers = UCombatTimerSubsystem::Get(this);
+    return Timers ? Timers->GetTimeRemaining(AbilityQCooldownHandle) : 0.0f;
+}
+
+float AWeaponBase::GetAbilityECooldownRemaining() const
+{
+    const UCombatTimerSubsystem* Timers = UCombatTimerSubsystem::Get(this);
+    return Timers ? Timers->GetTimeRemaining(AbilityECooldownHandle) : 0.0f;
 }
 
 void AWeaponBase::BasicAttack(AActor* Target)
 {
-    if (!Target || !OwnerHealthComponent)
+    if (!OwnerHealthComponent)
+    {
+        return;
+    }
+
+    if (!Target)
     {
+        BasicAttackHorde();
         return;
     }
 
@@ -84,7 +102,7 @@ void AWeaponBase::BasicAttack(AActor* Target)
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("BasicAttack: Attack timer already active, not resetting"));
+        UE_LOG(LogTrinityFlowCombat, VeryVerbose, TEXT("BasicAttack: Attack timer already active, not resetting"));
     }
 
     // Draw debug for attack wind-up
@@ -121,41 +139,14 @@ void AWeaponBase::ExecuteBasicAttack(AActor* Target)
         return;
     }
 
-    if (UHealthComponent* TargetHealth = Target->FindComponentByClass<UHealthComponent>())
+    if (UHealthComponent* TargetHealth = UCombatantHandleSubsystem::Get(Target).Health.Get())
     {
-        FDamageInfo DamageInfo;
-        DamageInfo.Amount = OwnerHealthComponent->GetResources().AttackPoint;
-        
-        // Apply shard damage bonuses
-        if (OwnerPawn)
-        {
-            if (UShardComponent* ShardComp = OwnerPawn->FindComponentByClass<UShardComponent>())
-            {
-                float DamageMultiplier = 1.0f;
-                
-                if (BasicDamageType == EDamageType::Soul)
-                {
-                    DamageMultiplier += ShardComp->GetSoulDamageBonus();
-                }
-                else if (BasicDamageType == EDamageType::Physical)
-                {
-                    DamageMultiplier += ShardComp->GetPhysicalDamageBonus();
-                }
-                
-                DamageInfo.Amount *= DamageMultiplier;
-                
-                UE_LOG(LogTemp, Warning, TEXT("Applied shard damage bonus: %.1f%% (Multiplier: %.2f)"), 
-                    (DamageMultiplier - 1.0f) * 100.0f, DamageMultiplier);
-            }
-        }
-        
-        DamageInfo.Type = BasicDamageType;
-        DamageInfo.Instigator = OwnerPawn;
-        DamageInfo.bIsLeftWeapon = bIsLeftHandWeapon;
+        const FDamageInfo DamageInfo = MakeAttackDamage(BasicDamageType);
         
-        UE_LOG(LogTemp, Warning, TEXT("WeaponBase ExecuteBasicAttack: Instigator=%s, Target=%s, Damage=%.1f, IsLeftWeapon=%s"), 
+        TRINITYFLOW_RECORD_COMBAT(AttackExecuted, OwnerPawn, Target, DamageInfo.Amount, 0.0f, bIsLeftHandWeapon ? 1 : 0);
+        UE_LOG(LogTrinityFlowCombat, Verbose, TEXT("WeaponBase ExecuteBasicAttack: Instigator=%s, Target=%s, Damage=%.1f, IsLeftWeapon=%s"), 
             OwnerPawn ? *OwnerPawn->GetName() : TEXT("NULL"),
-            Target ? *Target->GetName() : TEXT("NULL"),
+            *Target->GetName(),
             DamageInfo.Amount,
             bIsLeftHandWeapon ? TEXT("Yes") : TEXT("No"));
 
@@ -172,9 +163,82 @@ void AWeaponBase::ExecuteBasicAttack(AActor* Target)
     PendingAttackTarget = nullptr;
 }
 
-void AWeaponBase::StartCooldown(float& Timer, float Cooldown)
+FDamageInfo AWeaponBase::MakeAttackDamage(EDamageType DamageType) const
+{
+    FDamageInfo DamageInfo = UCombatAttributeSubsystem::MakeAttackDamage(OwnerPawn, DamageType);
+    DamageInfo.bIsLeftWeapon = bIsLeftHandWeapon;
+    return DamageInfo;
+}
+
+void AWeaponBase::BasicAttackHorde()
 {
-    Timer = Cooldown;
+    UEnemyHordeSubsystem* Horde = UEnemyHordeSubsystem::Get(this);
+    if (!Horde || !OwnerPawn || GetWorld()->GetTimerManager().IsTimerActive(AttackTimerHandle))
+    {
+        return;
+    }
+
+    // The sight trace only finds actors; strike the nearest horde entity in front of the owner's aim
+    const FHordeEntityId Entity = Horde->FindEntityInCone(OwnerPawn->GetActorLocation(),
+        OwnerPawn->GetBaseAimRotation().Vector(), BasicAttackRange, HordeAttackHalfAngle);
+    if (!Entity.IsValid())
+    {
+        return;
+    }
+
+    GetWorld()->GetTimerManager().SetTimer(
+        AttackTimerHandle,
+        FTimerDelegate::CreateUObject(this, &AWeaponBase::ExecuteHordeAttack, Entity),
+        BasicAttackDamageDelay,
+        false
+    );
+}
+
+void AWeaponBase::ExecuteHordeAttack(FHordeEntityId Entity)
+{
+    // Same leeway for a moving target as ExecuteBasicAttack
+    HitHordeEntity(Entity, BasicDamageType, BasicAttackRange * 1.5f, FColor::Red);
+}
+
+bool AWeaponBase::HitHordeEntity(FHordeEntityId Entity, EDamageType DamageType, float MaxRange, const FColor& DebugColor)
+{
+    UEnemyHordeSubsystem* Horde = UEnemyHordeSubsystem::Get(this);
+
+    // The entity may have died or been promoted to an actor since it was picked
+    FVector EntityLocation;
+    if (!Horde || !OwnerHealthComponent || !Horde->GetEntityLocation(Entity, EntityLocation))
+    {
+        return false;
+    }
+
+    if (FVector::Dist(GetActorLocation(), EntityLocation) > MaxRange)
+    {
+        return false;
+    }
+
+    const FVector DamageDirection = (EntityLocation - GetActorLocation()).GetSafeNormal();
+    Horde->ApplyDamage(Entity, MakeAttackDamage(DamageType), DamageDirection);
+
+#if !UE_BUILD_SHIPPING
+    DrawDebugLine(GetWorld(), GetActorLocation(), EntityLocation, DebugColor, false, 0.5f, 0, 3.0f);
+#endif
+    return true;
+}
+
+void AWeaponBase::StartCooldown(FCombatTimerHandle& Handle, float Cooldown)
+{
+    if (UCombatTimerSubsystem* Timers = UCombatTimerSubsystem::Get(this))
+    {
+        Timers->SetTimer(Handle, Cooldown);
+    }
+}
+
+void AWeaponBase::ResetCooldown(FCombatTimerHandle& Handle)
+{
+    if (UCombatTimerSubsystem* Timers = UCombatTimerSubsystem::Get(this))
+    {
+        Timers->ClearTimer(Handle);
+    }
 }
 
 void AWeaponBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
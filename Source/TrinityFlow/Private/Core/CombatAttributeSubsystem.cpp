@@ -0,0 +1,138 @@
+#include "Core/CombatAttributeSubsystem.h"
+#include "Core/CombatantHandleSubsystem.h"
+#include "Core/HealthComponent.h"
+#include "Core/ShardComponent.h"
+#include "Core/StanceComponent.h"
+#include "Core/TagComponent.h"
+#include "Data/TrinityFlowTagData.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static_assert(FCombatAttributes::NumDamageTypes == FCompiledTagTable::NumDamageTypes, "Attribute arrays are indexed by EDamageType");
+
+void UCombatAttributeSubsystem::Deinitialize()
+{
+    Entries.Empty();
+    Super::Deinitialize();
+}
+
+void UCombatAttributeSubsystem::Compute(const AActor* Actor, FCombatAttributes& OutAttributes)
+{
+    OutAttributes = FCombatAttributes();
+    if (!Actor)
+    {
+        return;
+    }
+
+    const FCombatantHandles& Handles = UCombatantHandleSubsystem::Get(Actor);
+    const UHealthComponent* Health = Handles.Health.Get();
+    const UShardComponent* Shard = Handles.Shard.Get();
+    const UStanceComponent* Stance = Handles.Stance.Get();
+    const UTagComponent* Tags = Handles.Tags.Get();
+
+    const float AttackPoint = Health ? Health->GetResources().AttackPoint : 0.0f;
+    OutAttributes.Defence = Health ? Health->GetResources().DefencePoint : 0.0f;
+    OutAttributes.DamageTags = Tags ? Tags->GetTags() : ECharacterTag::None;
+
+    for (int32 TypeIndex = 0; TypeIndex < FCombatAttributes::NumDamageTypes; TypeIndex++)
+    {
+        const EDamageType Type = static_cast<EDamageType>(TypeIndex);
+
+        float ShardBonus = 0.0f;
+        if (Shard)
+        {
+            ShardBonus = Type == EDamageType::Soul ? Shard->GetSoulDamageBonus() : Shard->GetPhysicalDamageBonus();
+        }
+
+        const float StanceModifier = Stance ? Stance->GetDamageModifier(Type) : 1.0f;
+
+        OutAttributes.OutgoingDamage[TypeIndex] = AttackPoint * (1.0f + ShardBonus) * StanceModifier;
+    }
+}
+
+const FCombatAttributes& UCombatAttributeSubsystem::Find(const AActor* Actor)
+{
+    Lookups++;
+
+    FAttributeEntry* Entry = Entries.Find(Actor);
+    if (!Entry)
+    {
+        // Only actors in play are cached; anything else is computed into scratch storage
+        if (!Actor || !(Actor->HasActorBegunPlay() || Actor->IsActorBeginningPlay()) || Actor->IsActorBeingDestroyed())
+        {
+            Recomputes++;
+            Compute(Actor, TransientAttributes);
+            return TransientAttributes;
+        }
+
+        Entry = &Entries.Add(Actor);
+        const_cast<AActor*>(Actor)->OnEndPlay.AddUniqueDynamic(this, &UCombatAttributeSubsystem::OnActorEndPlay);
+    }
+
+    if (Entry->bDirty)
+    {
+        Recomputes++;
+        Compute(Actor, Entry->Attributes);
+        Entry->bDirty = false;
+    }
+
+    return Entry->Attributes;
+}
+
+void UCombatAttributeSubsystem::MarkDirty(const AActor* Actor)
+{
+    if (FAttributeEntry* Entry = Entries.Find(Actor))
+    {
+        Entry->bDirty = true;
+    }
+}
+
+const FCombatAttributes& UCombatAttributeSubsystem::Get(const AActor* Actor)
+{
+    UWorld* World = Actor ? Actor->GetWorld() : nullptr;
+    if (UCombatAttributeSubsystem* Subsystem = World ? World->GetSubsystem<UCombatAttributeSubsystem>() : nullptr)
+    {
+        return Subsystem->Find(Actor);
+    }
+
+    // No world (e.g. CDOs): compute without caching
+    static FCombatAttributes UncachedAttributes;
+    check(IsInGameThread());
+    Compute(Actor, UncachedAttributes);
+    return UncachedAttributes;
+}
+
+FDamageInfo UCombatAttributeSubsystem::MakeAttackDamage(AActor* Instigator, EDamageType Type)
+{
+    return FDamageInfo(Get(Instigator).GetOutgoingDamage(Type), Type, Instigator);
+}
+
+void UCombatAttributeSubsystem::NotifySourceChanged(const UActorComponent* Source)
+{
+    UWorld* World = Source ? Source->GetWorld() : nullptr;
+    if (UCombatAttributeSubsystem* Subsystem = World ? World->GetSubsystem<UCombatAttributeSubsystem>() : nullptr)
+    {
+        Subsystem->MarkDirty(Source->GetOwner());
+    }
+}
+
+void UCombatAttributeSubsystem::OnActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+    Entries.Remove(Actor);
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorld AttributeStatsCommand(
+    TEXT("TrinityFlow.Attributes.Stats"),
+    TEXT("Logs how often cached combat attributes had to be recomputed"),
+    FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+    {
+        if (UCombatAttributeSubsystem* Attributes = World ? World->GetSubsystem<UCombatAttributeSubsystem>() : nullptr)
+        {
+            UE_LOG(LogTemp, Log, TEXT("Combat attributes: %d actors cached, %llu lookups, %llu recomputes"),
+                Attributes->GetNumCached(), Attributes->GetLookups(), Attributes->GetRecomputes());
+        }
+    }));
+#endif
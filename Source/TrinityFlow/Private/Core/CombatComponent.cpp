@@ -1,5 +1,9 @@
 #include "Core/CombatComponent.h"
+#include "AI/EnemyHordeSubsystem.h"
 #include "Core/HealthComponent.h"
+#include "Core/CombatantHandleSubsystem.h"
+#include "Core/CombatAttributeSubsystem.h"
+#include "Core/CombatSpatialGridSubsystem.h"
 #include "DrawDebugHelpers.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
@@ -11,6 +15,7 @@
 UCombatComponent::UCombatComponent()
 {
     PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
 }
 
 void UCombatComponent::BeginPlay()
@@ -31,12 +36,6 @@ void UCombatComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActo
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-    // Update cooldown
-    if (AttackCooldownTimer > 0.0f)
-    {
-        AttackCooldownTimer -= DeltaTime;
-    }
-
     // Update casting
     if (bIsCasting && CurrentTarget)
     {
@@ -49,6 +48,7 @@ void UCombatComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActo
             bIsCasting = false;
             CastingTimer = 0.0f;
             CurrentTarget = nullptr;
+            SetComponentTickEnabled(false);
             return;
         }
         
@@ -102,11 +102,23 @@ void UCombatComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActo
             CurrentTarget = nullptr;
         }
     }
+
+    if (!bIsCasting)
+    {
+        SetComponentTickEnabled(false);
+    }
 }
 
 bool UCombatComponent::CanAttack() const
 {
-    return AttackCooldownTimer <= 0.0f && !bIsCasting;
+    const UCombatTimerSubsystem* Timers = UCombatTimerSubsystem::Get(this);
+    return !bIsCasting && !(Timers && Timers->IsTimerActive(AttackCooldownHandle));
+}
+
+float UCombatComponent::GetAttackCooldownRemaining() const
+{
+    const UCombatTimerSubsystem* Timers = UCombatTimerSubsystem::Get(this);
+    return Timers ? Timers->GetTimeRemaining(AttackCooldownHandle) : 0.0f;
 }
 
 void UCombatComponent::StartAttack(AActor* Target, float Range, EDamageType DamageType, bool bIsAreaDamage)
@@ -127,7 +139,12 @@ void UCombatComponent::StartAttack(AActor* Target, float Range, EDamageType Dama
     bPendingAreaDamage = bIsAreaDamage;
     bIsCasting = true;
     CastingTimer = 0.0f;
-    AttackCooldownTimer = AttackCooldown;
+    SetComponentTickEnabled(true);
+
+    if (UCombatTimerSubsystem* Timers = UCombatTimerSubsystem::Get(this))
+    {
+        Timers->SetTimer(AttackCooldownHandle, AttackCooldown);
+    }
 }
 
 void UCombatComponent::SetAttackSpeed(float AttacksPerSecond)
@@ -142,32 +159,48 @@ void UCombatComponent::ExecuteAttack()
         return;
     }
 
-    FDamageInfo DamageInfo;
-    DamageInfo.Amount = OwnerHealthComponent->GetResources().AttackPoint;
-    DamageInfo.Type = PendingDamageType;
-    DamageInfo.Instigator = GetOwner();
+    FDamageInfo DamageInfo = UCombatAttributeSubsystem::MakeAttackDamage(GetOwner(), PendingDamageType);
     DamageInfo.bIsAreaDamage = bPendingAreaDamage;
     DamageInfo.bIsLeftWeapon = false; // Enemies use right hand by default
 
     if (bPendingAreaDamage)
     {
         // Area damage
-        TArray<FOverlapResult> OverlapResults;
-        FCollisionQueryParams QueryParams;
-        QueryParams.AddIgnoredActor(GetOwner());
-
-        GetWorld()->OverlapMultiByChannel(
-            OverlapResults,
-            CurrentTarget->GetActorLocation(),
-            FQuat::Identity,
-            ECC_Pawn,
-            FCollisionShape::MakeSphere(400.0f),
-            QueryParams
-        );
-
-        for (const FOverlapResult& Result : OverlapResults)
+        TArray<AActor*> HitActors;
+        if (UCombatSpatialGridSubsystem* SpatialGrid = GetWorld()->GetSubsystem<UCombatSpatialGridSubsystem>())
+        {
+            SpatialGrid->QueryRadius(CurrentTarget->GetActorLocation(), AreaDamageRadius, HitActors, GetOwner());
+        }
+        else
+        {
+            TArray<FOverlapResult> OverlapResults;
+            FCollisionQueryParams QueryParams;
+            QueryParams.AddIgnoredActor(GetOwner());
+
+            GetWorld()->OverlapMultiByChannel(
+                OverlapResults,
+                CurrentTarget->GetActorLocation(),
+                FQuat::Identity,
+                ECC_Pawn,
+                FCollisionShape::MakeSphere(AreaDamageRadius),
+                QueryParams
+            );
+
+            for (const FOverlapResult& Result : OverlapResults)
+            {
+                HitActors.AddUnique(Result.GetActor());
+            }
+        }
+
+        // Entities still in the horde are not in the grid; they take the same area hit in one batch
+        if (UEnemyHordeSubsystem* Horde = UEnemyHordeSubsystem::Get(this))
+        {
+            Horde->ApplyRadialDamage(CurrentTarget->GetActorLocation(), AreaDamageRadius, DamageInfo);
+        }
+
+        for (AActor* HitActor : HitActors)
         {
-            if (AActor* HitActor = Result.GetActor())
+            if (HitActor)
             {
                 // Check if target is player with defensive ability system
                 if (ATrinityFlowCharacter* PlayerTarget = Cast<ATrinityFlowCharacter>(HitActor))
@@ -175,7 +208,7 @@ void UCombatComponent::ExecuteAttack()
                     // Notify player of incoming attack for defensive ability window
                     PlayerTarget->OnIncomingAttack(GetOwner(), DamageInfo.Amount, DamageInfo.Type);
                 }
-                else if (UHealthComponent* HealthComp = HitActor->FindComponentByClass<UHealthComponent>())
+                else if (UHealthComponent* HealthComp = UCombatantHandleSubsystem::Get(HitActor).Health.Get())
                 {
                     FVector DamageDirection = (HitActor->GetActorLocation() - GetOwner()->GetActorLocation()).GetSafeNormal();
                     HealthComp->TakeDamage(DamageInfo, DamageDirection);
@@ -192,7 +225,7 @@ void UCombatComponent::ExecuteAttack()
             // Notify player of incoming attack for defensive ability window
             PlayerTarget->OnIncomingAttack(GetOwner(), DamageInfo.Amount, DamageInfo.Type);
         }
-        else if (UHealthComponent* TargetHealth = CurrentTarget->FindComponentByClass<UHealthComponent>())
+        else if (UHealthComponent* TargetHealth = UCombatantHandleSubsystem::Get(CurrentTarget).Health.Get())
         {
             // Normal damage for non-player targets
             FVector DamageDirection = (CurrentTarget->GetActorLocation() - GetOwner()->GetActorLocation()).GetSafeNormal();
@@ -0,0 +1,59 @@
+#include "Core/CombatEventBus.h"
+
+FDelegateHandle FCombatEventBus::Subscribe(ECombatEventType Type, FOnCombatEvent::FDelegate&& Listener)
+{
+    return Listeners[static_cast<int32>(Type)].Add(MoveTemp(Listener));
+}
+
+FDelegateHandle FCombatEventBus::SubscribeBatched(ECombatEventType Type, FOnCombatEventBatch::FDelegate&& Listener)
+{
+    return BatchListeners[static_cast<int32>(Type)].Add(MoveTemp(Listener));
+}
+
+void FCombatEventBus::Unsubscribe(ECombatEventType Type, FDelegateHandle Handle)
+{
+    const int32 TypeIndex = static_cast<int32>(Type);
+    if (!Listeners[TypeIndex].Remove(Handle))
+    {
+        BatchListeners[TypeIndex].Remove(Handle);
+    }
+}
+
+void FCombatEventBus::Publish(const FCombatEvent& Event)
+{
+    const int32 TypeIndex = static_cast<int32>(Event.Type);
+
+    Listeners[TypeIndex].Broadcast(Event);
+
+    // Only queue when someone will consume the batch
+    if (BatchListeners[TypeIndex].IsBound())
+    {
+        QueuedEvents[TypeIndex].Add(Event);
+    }
+}
+
+void FCombatEventBus::Flush()
+{
+    for (int32 TypeIndex = 0; TypeIndex < NumEventTypes; TypeIndex++)
+    {
+        if (QueuedEvents[TypeIndex].Num() == 0)
+        {
+            continue;
+        }
+
+        Swap(FlushingEvents, QueuedEvents[TypeIndex]);
+        BatchListeners[TypeIndex].Broadcast(FlushingEvents);
+        FlushingEvents.Reset();
+    }
+}
+
+void FCombatEventBus::Reset()
+{
+    for (int32 TypeIndex = 0; TypeIndex < NumEventTypes; TypeIndex++)
+    {
+        Listeners[TypeIndex].Clear();
+        BatchListeners[TypeIndex].Clear();
+        QueuedEvents[TypeIndex].Empty();
+    }
+    FlushingEvents.Empty();
+}
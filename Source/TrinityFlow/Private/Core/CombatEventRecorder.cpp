@@ -0,0 +1,377 @@
+#include "Core/CombatEventRecorder.h"
+#include "Core/TrinityFlowLog.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+#include "Serialization/Archive.h"
+
+namespace CombatRecordEncoding
+{
+    static void WriteVarInt(TArray<uint8>& Out, uint64 Value)
+    {
+        while (Value >= 0x80)
+        {
+            Out.Add(static_cast<uint8>(Value) | 0x80);
+            Value >>= 7;
+        }
+        Out.Add(static_cast<uint8>(Value));
+    }
+
+    static bool ReadVarInt(const uint8*& Cursor, const uint8* End, uint64& OutValue)
+    {
+        OutValue = 0;
+        for (int32 Shift = 0; Shift < 64 && Cursor < End; Shift += 7)
+        {
+            const uint8 Byte = *Cursor++;
+            OutValue |= static_cast<uint64>(Byte & 0x7F) << Shift;
+            if ((Byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static void WriteSignedDelta(TArray<uint8>& Out, uint32 Value, uint32 Previous)
+    {
+        const int64 Delta = static_cast<int64>(Value) - static_cast<int64>(Previous);
+        WriteVarInt(Out, (static_cast<uint64>(Delta) << 1) ^ static_cast<uint64>(Delta >> 63));
+    }
+
+    static bool ReadSignedDelta(const uint8*& Cursor, const uint8* End, uint32 Previous, uint32& OutValue)
+    {
+        uint64 ZigZag;
+        if (!ReadVarInt(Cursor, End, ZigZag))
+        {
+            return false;
+        }
+        const int64 Delta = static_cast<int64>(ZigZag >> 1) ^ -static_cast<int64>(ZigZag & 1);
+        OutValue = static_cast<uint32>(static_cast<int64>(Previous) + Delta);
+        return true;
+    }
+
+    template<typename T>
+    static void WriteRaw(TArray<uint8>& Out, const T& Value)
+    {
+        Out.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+    }
+
+    template<typename T>
+    static bool ReadRaw(const uint8*& Cursor, const uint8* End, T& OutValue)
+    {
+        if (End - Cursor < static_cast<int64>(sizeof(T)))
+        {
+            return false;
+        }
+        FMemory::Memcpy(&OutValue, Cursor, sizeof(T));
+        Cursor += sizeof(T);
+        return true;
+    }
+}
+
+void FCombatRecordCodec::WriteHeader(TArray<uint8>& Out, int64 StartTicks)
+{
+    CombatRecordEncoding::WriteRaw(Out, FileMagic);
+    CombatRecordEncoding::WriteRaw(Out, FileVersion);
+    CombatRecordEncoding::WriteRaw(Out, StartTicks);
+}
+
+bool FCombatRecordCodec::ReadHeader(const uint8*& Cursor, const uint8* End, int64& OutStartTicks)
+{
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    return CombatRecordEncoding::ReadRaw(Cursor, End, Magic) && Magic == FileMagic
+        && CombatRecordEncoding::ReadRaw(Cursor, End, Version) && Version == FileVersion
+        && CombatRecordEncoding::ReadRaw(Cursor, End, OutStartTicks);
+}
+
+void FCombatRecordCodec::Encode(const FCombatRecord& Record, FCombatRecord& Previous, TArray<uint8>& Out)
+{
+    using namespace CombatRecordEncoding;
+
+    Out.Add(static_cast<uint8>(Record.Type));
+    Out.Add(Record.Param);
+
+    // Records from worker threads can land slightly out of order, so clamp rather than go negative
+    WriteVarInt(Out, Record.TimeMicros > Previous.TimeMicros ? Record.TimeMicros - Previous.TimeMicros : 0);
+    WriteVarInt(Out, Record.Frame > Previous.Frame ? Record.Frame - Previous.Frame : 0);
+    WriteSignedDelta(Out, Record.SourceId, Previous.SourceId);
+    WriteSignedDelta(Out, Record.TargetId, Previous.TargetId);
+    WriteRaw(Out, Record.Values[0]);
+    WriteRaw(Out, Record.Values[1]);
+
+    Previous.TimeMicros = FMath::Max(Previous.TimeMicros, Record.TimeMicros);
+    Previous.Frame = FMath::Max(Previous.Frame, Record.Frame);
+    Previous.SourceId = Record.SourceId;
+    Previous.TargetId = Record.TargetId;
+}
+
+bool FCombatRecordCodec::Decode(const uint8*& Cursor, const uint8* End, FCombatRecord& Previous, FCombatRecord& OutRecord)
+{
+    using namespace CombatRecordEncoding;
+
+    if (End - Cursor < 2 || Cursor[0] >= static_cast<uint8>(ECombatRecordType::Count))
+    {
+        return false;
+    }
+
+    OutRecord.Type = static_cast<ECombatRecordType>(*Cursor++);
+    OutRecord.Param = *Cursor++;
+
+    uint64 TimeDelta;
+    uint64 FrameDelta;
+    if (!ReadVarInt(Cursor, End, TimeDelta) || !ReadVarInt(Cursor, End, FrameDelta)
+        || !ReadSignedDelta(Cursor, End, Previous.SourceId, OutRecord.SourceId)
+        || !ReadSignedDelta(Cursor, End, Previous.TargetId, OutRecord.TargetId)
+        || !ReadRaw(Cursor, End, OutRecord.Values[0]) || !ReadRaw(Cursor, End, OutRecord.Values[1]))
+    {
+        return false;
+    }
+
+    OutRecord.TimeMicros = Previous.TimeMicros + TimeDelta;
+    OutRecord.Frame = Previous.Frame + static_cast<uint32>(FrameDelta);
+    Previous = OutRecord;
+    return true;
+}
+
+const TCHAR* FCombatRecordCodec::GetTypeName(ECombatRecordType Type)
+{
+    switch (Type)
+    {
+    case ECombatRecordType::AttackExecuted: return TEXT("AttackExecuted");
+    case ECombatRecordType::DamageApplied:  return TEXT("DamageApplied");
+    case ECombatRecordType::EchoDamage:     return TEXT("EchoDamage");
+    case ECombatRecordType::Death:          return TEXT("Death");
+    case ECombatRecordType::PathRequested:  return TEXT("PathRequested");
+    case ECombatRecordType::PathCompleted:  return TEXT("PathCompleted");
+    default:                                return TEXT("Unknown");
+    }
+}
+
+FCombatEventRecorder& FCombatEventRecorder::Get()
+{
+    static FCombatEventRecorder Recorder;
+    return Recorder;
+}
+
+FCombatEventRecorder::FCombatEventRecorder()
+{
+    Slots = MakeUnique<FSlot[]>(Capacity);
+    for (uint32 Index = 0; Index < Capacity; Index++)
+    {
+        Slots[Index].Sequence.store(Index, std::memory_order_relaxed);
+    }
+}
+
+FCombatEventRecorder::~FCombatEventRecorder()
+{
+    Stop();
+}
+
+void FCombatEventRecorder::Record(ECombatRecordType Type, const UObject* Source, const UObject* Target,
+    float Value0, float Value1, uint8 Param)
+{
+    FCombatEventRecorder& Recorder = Get();
+    if (!Recorder.bRecording.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    FCombatRecord Record;
+    Record.TimeMicros = static_cast<uint64>(FMath::Max(0.0, FPlatformTime::Seconds() - Recorder.StartSeconds) * 1000000.0);
+    Record.Frame = static_cast<uint32>(GFrameCounter);
+    Record.SourceId = Source ? Source->GetUniqueID() : 0;
+    Record.TargetId = Target ? Target->GetUniqueID() : 0;
+    Record.Values[0] = Value0;
+    Record.Values[1] = Value1;
+    Record.Type = Type;
+    Record.Param = Param;
+
+    if (Recorder.Push(Record))
+    {
+        Recorder.NumRecorded.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        Recorder.NumDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+bool FCombatEventRecorder::Push(const FCombatRecord& Record)
+{
+    uint32 Position = EnqueuePosition.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        FSlot& Slot = Slots[Position & IndexMask];
+        const uint32 Sequence = Slot.Sequence.load(std::memory_order_acquire);
+        const int32 Difference = static_cast<int32>(Sequence - Position);
+
+        if (Difference == 0)
+        {
+            // Slot is free for this lap; claim it
+            if (EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+            {
+                Slot.Record = Record;
+                Slot.Sequence.store(Position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (Difference < 0)
+        {
+            // The consumer has not freed this slot yet: the ring is full
+            return false;
+        }
+        else
+        {
+            Position = EnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool FCombatEventRecorder::Pop(FCombatRecord& OutRecord)
+{
+    FSlot& Slot = Slots[DequeuePosition & IndexMask];
+    const uint32 Sequence = Slot.Sequence.load(std::memory_order_acquire);
+    if (static_cast<int32>(Sequence - (DequeuePosition + 1)) < 0)
+    {
+        return false;
+    }
+
+    OutRecord = Slot.Record;
+    Slot.Sequence.store(DequeuePosition + Capacity, std::memory_order_release);
+    DequeuePosition++;
+    return true;
+}
+
+bool FCombatEventRecorder::Start()
+{
+    check(IsInGameThread());
+
+    if (Thread)
+    {
+        return false;
+    }
+
+    const FString Directory = FPaths::ProjectSavedDir() / TEXT("CombatRecordings");
+    const FDateTime Now = FDateTime::Now();
+    Filename = Directory / FString::Printf(TEXT("Combat_%s.tfrec"), *Now.ToString());
+
+    IFileManager::Get().MakeDirectory(*Directory, true);
+    Writer.Reset(IFileManager::Get().CreateFileWriter(*Filename));
+    if (!Writer)
+    {
+        UE_LOG(LogTrinityFlowCombat, Warning, TEXT("Combat recorder: could not open %s"), *Filename);
+        return false;
+    }
+
+    // Discard anything pushed after the previous recording stopped
+    FCombatRecord Stale;
+    while (Pop(Stale))
+    {
+    }
+
+    PreviousRecord = FCombatRecord();
+    EncodeBuffer.Reset();
+    FCombatRecordCodec::WriteHeader(EncodeBuffer, Now.GetTicks());
+    Writer->Serialize(EncodeBuffer.GetData(), EncodeBuffer.Num());
+    BytesWritten.store(EncodeBuffer.Num(), std::memory_order_relaxed);
+    NumRecorded.store(0, std::memory_order_relaxed);
+    NumDropped.store(0, std::memory_order_relaxed);
+
+    StartSeconds = FPlatformTime::Seconds();
+    bStopRequested.store(false, std::memory_order_relaxed);
+    bRecording.store(true, std::memory_order_release);
+
+    Thread = FRunnableThread::Create(this, TEXT("CombatEventRecorder"), 0, TPri_BelowNormal);
+    return Thread != nullptr;
+}
+
+void FCombatEventRecorder::Stop()
+{
+    if (!Thread)
+    {
+        return;
+    }
+
+    bRecording.store(false, std::memory_order_release);
+    bStopRequested.store(true, std::memory_order_release);
+
+    Thread->WaitForCompletion();
+    delete Thread;
+    Thread = nullptr;
+}
+
+uint32 FCombatEventRecorder::Run()
+{
+    while (!bStopRequested.load(std::memory_order_acquire))
+    {
+        Drain();
+        FPlatformProcess::Sleep(0.01f);
+    }
+
+    // Pick up whatever was pushed before the stop request
+    Drain();
+
+    Writer->Close();
+    Writer.Reset();
+    return 0;
+}
+
+void FCombatEventRecorder::Drain()
+{
+    EncodeBuffer.Reset();
+
+    FCombatRecord Record;
+    while (Pop(Record))
+    {
+        FCombatRecordCodec::Encode(Record, PreviousRecord, EncodeBuffer);
+    }
+
+    if (EncodeBuffer.Num() > 0)
+    {
+        Writer->Serialize(EncodeBuffer.GetData(), EncodeBuffer.Num());
+        BytesWritten.fetch_add(EncodeBuffer.Num(), std::memory_order_relaxed);
+    }
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommand RecorderStartCommand(
+    TEXT("TrinityFlow.Recorder.Start"),
+    TEXT("Starts writing binary combat records to Saved/CombatRecordings"),
+    FConsoleCommandDelegate::CreateLambda([]()
+    {
+        FCombatEventRecorder& Recorder = FCombatEventRecorder::Get();
+        if (Recorder.Start())
+        {
+            UE_LOG(LogTrinityFlowCombat, Log, TEXT("Combat recorder: recording to %s"), *Recorder.GetFilename());
+        }
+    }));
+
+static FAutoConsoleCommand RecorderStopCommand(
+    TEXT("TrinityFlow.Recorder.Stop"),
+    TEXT("Stops the combat recorder and flushes the recording file"),
+    FConsoleCommandDelegate::CreateLambda([]()
+    {
+        FCombatEventRecorder& Recorder = FCombatEventRecorder::Get();
+        if (Recorder.IsRecording())
+        {
+            Recorder.Stop();
+            UE_LOG(LogTrinityFlowCombat, Log, TEXT("Combat recorder: wrote %llu records (%lld bytes, %llu dropped) to %s"),
+                Recorder.GetNumRecorded(), Recorder.GetBytesWritten(), Recorder.GetNumDropped(), *Recorder.GetFilename());
+        }
+    }));
+
+static FAutoConsoleCommand RecorderStatsCommand(
+    TEXT("TrinityFlow.Recorder.Stats"),
+    TEXT("Logs how many combat records were written and dropped"),
+    FConsoleCommandDelegate::CreateLambda([]()
+    {
+        const FCombatEventRecorder& Recorder = FCombatEventRecorder::Get();
+        UE_LOG(LogTrinityFlowCombat, Log, TEXT("Combat recorder: %s, %llu records, %llu dropped, %lld bytes"),
+            Recorder.IsRecording() ? TEXT("recording") : TEXT("idle"),
+            Recorder.GetNumRecorded(), Recorder.GetNumDropped(), Recorder.GetBytesWritten());
+    }));
+#endif
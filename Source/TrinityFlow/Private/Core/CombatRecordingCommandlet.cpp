@@ -0,0 +1,109 @@
+#include "Core/CombatRecordingCommandlet.h"
+#include "Core/CombatEventRecorder.h"
+#include "Core/TrinityFlowLog.h"
+#include "Misc/FileHelper.h"
+#include "Misc/DateTime.h"
+#include "Misc/Parse.h"
+
+UCombatRecordingCommandlet::UCombatRecordingCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UCombatRecordingCommandlet::Main(const FString& Params)
+{
+    FString Filename;
+    if (!FParse::Value(*Params, TEXT("File="), Filename))
+    {
+        UE_LOG(LogTrinityFlowCombat, Error, TEXT("Usage: -run=CombatRecording -File=<path.tfrec> [-Csv=<out.csv>] [-Summary]"));
+        return 1;
+    }
+
+    TArray<uint8> Data;
+    if (!FFileHelper::LoadFileToArray(Data, *Filename))
+    {
+        UE_LOG(LogTrinityFlowCombat, Error, TEXT("Could not read %s"), *Filename);
+        return 1;
+    }
+
+    const uint8* Cursor = Data.GetData();
+    const uint8* End = Cursor + Data.Num();
+
+    int64 StartTicks = 0;
+    if (!FCombatRecordCodec::ReadHeader(Cursor, End, StartTicks))
+    {
+        UE_LOG(LogTrinityFlowCombat, Error, TEXT("%s is not a combat recording (or was written by another version)"), *Filename);
+        return 1;
+    }
+
+    FString CsvFilename;
+    const bool bWriteCsv = FParse::Value(*Params, TEXT("Csv="), CsvFilename);
+    const bool bSummaryOnly = FParse::Param(*Params, TEXT("Summary"));
+
+    TArray<FString> CsvLines;
+    if (bWriteCsv)
+    {
+        CsvLines.Add(TEXT("TimeMs,Frame,Type,Source,Target,Value0,Value1,Param"));
+    }
+
+    int32 TypeCounts[static_cast<int32>(ECombatRecordType::Count)] = {};
+    double DamageTotal = 0.0;
+    int32 NumRecords = 0;
+
+    FCombatRecord Previous;
+    FCombatRecord Record;
+    while (Cursor < End)
+    {
+        if (!FCombatRecordCodec::Decode(Cursor, End, Previous, Record))
+        {
+            UE_LOG(LogTrinityFlowCombat, Warning, TEXT("Truncated or corrupt record at byte %lld; stopping"),
+                static_cast<int64>(Cursor - Data.GetData()));
+            break;
+        }
+
+        NumRecords++;
+        TypeCounts[static_cast<int32>(Record.Type)]++;
+        if (Record.Type == ECombatRecordType::DamageApplied)
+        {
+            DamageTotal += Record.Values[0];
+        }
+
+        const double TimeMs = Record.TimeMicros / 1000.0;
+        if (bWriteCsv)
+        {
+            CsvLines.Add(FString::Printf(TEXT("%.3f,%u,%s,%u,%u,%g,%g,%u"), TimeMs, Record.Frame,
+                FCombatRecordCodec::GetTypeName(Record.Type), Record.SourceId, Record.TargetId,
+                Record.Values[0], Record.Values[1], Record.Param));
+        }
+        else if (!bSummaryOnly)
+        {
+            UE_LOG(LogTrinityFlowCombat, Display, TEXT("%10.3f ms  frame %-8u %-15s %6u -> %-6u %10.2f %10.2f  %u"),
+                TimeMs, Record.Frame, FCombatRecordCodec::GetTypeName(Record.Type), Record.SourceId, Record.TargetId,
+                Record.Values[0], Record.Values[1], Record.Param);
+        }
+    }
+
+    if (bWriteCsv && !FFileHelper::SaveStringArrayToFile(CsvLines, *CsvFilename))
+    {
+        UE_LOG(LogTrinityFlowCombat, Error, TEXT("Could not write %s"), *CsvFilename);
+        return 1;
+    }
+
+    UE_LOG(LogTrinityFlowCombat, Display, TEXT("%s: recorded %s, %d records in %d bytes (%.1f bytes/record), %.1f total damage"),
+        *Filename, *FDateTime(StartTicks).ToString(), NumRecords, Data.Num(),
+        NumRecords > 0 ? static_cast<double>(Data.Num()) / NumRecords : 0.0, DamageTotal);
+
+    for (int32 TypeIndex = 0; TypeIndex < static_cast<int32>(ECombatRecordType::Count); TypeIndex++)
+    {
+        if (TypeCounts[TypeIndex] > 0)
+        {
+            UE_LOG(LogTrinityFlowCombat, Display, TEXT("  %-15s %d"),
+                FCombatRecordCodec::GetTypeName(static_cast<ECombatRecordType>(TypeIndex)), TypeCounts[TypeIndex]);
+        }
+    }
+
+    return 0;
+}
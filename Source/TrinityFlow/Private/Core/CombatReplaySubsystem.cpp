@@ -0,0 +1,505 @@
+#include "Core/CombatReplaySubsystem.h"
+#include "Core/CombatantHandleSubsystem.h"
+#include "Core/HealthComponent.h"
+#include "Core/TrinityFlowLog.h"
+#include "AI/EnemyHordeSubsystem.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+namespace CombatReplay
+{
+    static constexpr uint32 FileMagic = 0x50524654; // "TFRP"
+    static constexpr uint32 FileVersion = 1;
+
+    static FString GetDirectory()
+    {
+        return FPaths::ProjectSavedDir() / TEXT("CombatReplays");
+    }
+}
+
+bool UCombatReplaySubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    const UWorld* World = Cast<UWorld>(Outer);
+    return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UCombatReplaySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // Live play still draws from the stream, just with a seed nobody needs to reproduce
+    RandomStream.Initialize(static_cast<int32>(FPlatformTime::Cycles()));
+
+    PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &UCombatReplaySubsystem::OnWorldPreActorTick);
+}
+
+void UCombatReplaySubsystem::Deinitialize()
+{
+    FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+
+    if (IsRecording())
+    {
+        FinishRecording();
+    }
+    else if (IsReplaying())
+    {
+        FinishReplay();
+    }
+
+    InputSink.Unbind();
+    Super::Deinitialize();
+}
+
+void UCombatReplaySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    const TCHAR* CommandLine = FCommandLine::Get();
+
+    FString ReplayFile;
+    if (FParse::Value(CommandLine, TEXT("CombatReplay="), ReplayFile))
+    {
+        bExitWhenDone = FParse::Param(CommandLine, TEXT("CombatReplayExit"));
+        StartReplay(ReplayFile);
+        return;
+    }
+
+    FString RecordName;
+    if (FParse::Value(CommandLine, TEXT("CombatRecord="), RecordName) || FParse::Param(CommandLine, TEXT("CombatRecord")))
+    {
+        StartRecording(RecordName);
+    }
+}
+
+UCombatReplaySubsystem* UCombatReplaySubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UCombatReplaySubsystem>() : nullptr;
+}
+
+FRandomStream& UCombatReplaySubsystem::GetRandomStream(const UObject* WorldContextObject)
+{
+    if (UCombatReplaySubsystem* Replay = Get(WorldContextObject))
+    {
+        return Replay->RandomStream;
+    }
+
+    static FRandomStream FallbackStream(static_cast<int32>(FPlatformTime::Cycles()));
+    check(IsInGameThread());
+    return FallbackStream;
+}
+
+bool UCombatReplaySubsystem::IsAxisAction(EReplayInputAction Action)
+{
+    return Action == EReplayInputAction::Move || Action == EReplayInputAction::Look;
+}
+
+void UCombatReplaySubsystem::BeginFixedStep()
+{
+    bSavedUseFixedTimeStep = FApp::UseFixedTimeStep();
+    SavedFixedDeltaTime = FApp::GetFixedDeltaTime();
+
+    FApp::SetUseFixedTimeStep(true);
+    FApp::SetFixedDeltaTime(FixedDeltaTime);
+}
+
+void UCombatReplaySubsystem::EndFixedStep()
+{
+    FApp::SetUseFixedTimeStep(bSavedUseFixedTimeStep);
+    FApp::SetFixedDeltaTime(SavedFixedDeltaTime);
+}
+
+bool UCombatReplaySubsystem::StartRecording(const FString& Name)
+{
+    if (Mode != EMode::Idle)
+    {
+        return false;
+    }
+
+    const FString BaseName = Name.IsEmpty() ? FString::Printf(TEXT("Replay_%s"), *FDateTime::Now().ToString()) : Name;
+    Filename = CombatReplay::GetDirectory() / (BaseName + TEXT(".tfreplay"));
+    RecordedMapName = GetWorld()->GetMapName();
+
+    // One seed drives both the gameplay stream and FMath's global generators
+    Seed = static_cast<int32>(FPlatformTime::Cycles() & 0x7FFFFFFF);
+    RandomStream.Initialize(Seed);
+    FMath::RandInit(Seed);
+    FMath::SRandInit(Seed);
+
+    InputEvents.Reset();
+    SpawnEvents.Reset();
+    FrameIndex = 0;
+    NumFrames = 0;
+    LastFrameStartSeconds = 0.0;
+    bStopRecordingRequested = false;
+
+    BeginFixedStep();
+    Mode = EMode::Recording;
+
+    UE_LOG(LogTrinityFlowCombat, Log, TEXT("Combat replay: recording %s (seed %d)"), *Filename, Seed);
+    return true;
+}
+
+void UCombatReplaySubsystem::StopRecording()
+{
+    bStopRecordingRequested = IsRecording();
+}
+
+void UCombatReplaySubsystem::FinishRecording()
+{
+    NumFrames = FrameIndex;
+    RecordedStateHash = ComputeStateHash();
+
+    Mode = EMode::Idle;
+    EndFixedStep();
+
+    const bool bSaved = SaveRecording();
+    UE_LOG(LogTrinityFlowCombat, Log, TEXT("Combat replay: %s %s (%u frames, %d inputs, %d spawns, state hash %08x)"),
+        bSaved ? TEXT("saved") : TEXT("FAILED to save"), *Filename, NumFrames, InputEvents.Num(), SpawnEvents.Num(), RecordedStateHash);
+}
+
+bool UCombatReplaySubsystem::StartReplay(const FString& InFilename)
+{
+    if (Mode != EMode::Idle)
+    {
+        return false;
+    }
+
+    if (!LoadRecording(InFilename))
+    {
+        UE_LOG(LogTrinityFlowCombat, Error, TEXT("Combat replay: could not load %s"), *InFilename);
+        return false;
+    }
+
+    if (RecordedMapName != GetWorld()->GetMapName())
+    {
+        UE_LOG(LogTrinityFlowCombat, Warning, TEXT("Combat replay: recorded on %s but playing on %s"), *RecordedMapName, *GetWorld()->GetMapName());
+    }
+
+    RandomStream.Initialize(Seed);
+    FMath::RandInit(Seed);
+    FMath::SRandInit(Seed);
+
+    FrameIndex = 0;
+    NextInputEvent = 0;
+    NextSpawnEvent = 0;
+    Desyncs = 0;
+    FrameTimings.Reset(NumFrames);
+    LastFrameStartSeconds = 0.0;
+
+    BeginFixedStep();
+    Mode = EMode::Replaying;
+
+    UE_LOG(LogTrinityFlowCombat, Log, TEXT("Combat replay: playing %s (%u frames at %.4fs)"), *Filename, NumFrames, FixedDeltaTime);
+    return true;
+}
+
+void UCombatReplaySubsystem::RecordInput(EReplayInputAction Action, FVector2D Value)
+{
+    if (!IsRecording())
+    {
+        return;
+    }
+
+    FReplayInputEvent& Event = InputEvents.AddDefaulted_GetRef();
+    Event.Frame = FrameIndex;
+    Event.Action = Action;
+    Event.Value = FVector2f(Value);
+}
+
+void UCombatReplaySubsystem::RecordSpawn(uint8 EnemyType, int32 Count, const FVector& Location)
+{
+    if (IsRecording())
+    {
+        FReplaySpawnEvent& Event = SpawnEvents.AddDefaulted_GetRef();
+        Event.Frame = FrameIndex;
+        Event.EnemyType = EnemyType;
+        Event.Count = Count;
+        Event.Location = FVector3f(Location);
+    }
+    else if (IsReplaying())
+    {
+        // Spawns are driven by the level; the recording only checks they happen on the same frames
+        const bool bMatches = SpawnEvents.IsValidIndex(NextSpawnEvent)
+            && SpawnEvents[NextSpawnEvent].Frame == FrameIndex
+            && SpawnEvents[NextSpawnEvent].EnemyType == EnemyType
+            && SpawnEvents[NextSpawnEvent].Count == Count;
+
+        if (bMatches)
+        {
+            NextSpawnEvent++;
+        }
+        else
+        {
+            Desyncs++;
+            UE_LOG(LogTrinityFlowCombat, Warning, TEXT("Combat replay: unexpected spawn of type %d at frame %u"), EnemyType, FrameIndex);
+        }
+    }
+}
+
+void UCombatReplaySubsystem::OnWorldPreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+    if (InWorld != GetWorld() || Mode == EMode::Idle)
+    {
+        return;
+    }
+
+    if (IsRecording())
+    {
+        // Inputs recorded during this world tick belong to this frame
+        if (LastFrameStartSeconds > 0.0)
+        {
+            FrameIndex++;
+        }
+        LastFrameStartSeconds = FPlatformTime::Seconds();
+
+        if (bStopRecordingRequested)
+        {
+            FinishRecording();
+        }
+        return;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    if (LastFrameStartSeconds > 0.0)
+    {
+        FrameTimings.Add(FVector2f((Now - LastFrameStartSeconds) * 1000.0, FPlatformTime::ToMilliseconds(GGameThreadTime)));
+        FrameIndex++;
+    }
+    LastFrameStartSeconds = Now;
+
+    if (FrameIndex >= NumFrames)
+    {
+        FinishReplay();
+        return;
+    }
+
+    // Feed this frame's inputs before any actor ticks, where the player controller would have applied them
+    while (InputEvents.IsValidIndex(NextInputEvent) && InputEvents[NextInputEvent].Frame <= FrameIndex)
+    {
+        const FReplayInputEvent& Event = InputEvents[NextInputEvent++];
+        InputSink.ExecuteIfBound(Event.Action, FVector2D(Event.Value));
+    }
+}
+
+void UCombatReplaySubsystem::FinishReplay()
+{
+    if (!IsReplaying())
+    {
+        return;
+    }
+
+    Mode = EMode::Idle;
+    EndFixedStep();
+
+    const uint32 StateHash = ComputeStateHash();
+    Desyncs += SpawnEvents.Num() - NextSpawnEvent;
+
+    // Per-frame timing for comparing builds on the same workload
+    TArray<FString> CsvLines;
+    CsvLines.Reserve(FrameTimings.Num() + 1);
+    CsvLines.Add(TEXT("Frame,FrameMs,GameThreadMs"));
+
+    TArray<float> FrameTimes;
+    FrameTimes.Reserve(FrameTimings.Num());
+    double TotalMs = 0.0;
+    for (int32 Index = 0; Index < FrameTimings.Num(); Index++)
+    {
+        CsvLines.Add(FString::Printf(TEXT("%d,%.3f,%.3f"), Index, FrameTimings[Index].X, FrameTimings[Index].Y));
+        FrameTimes.Add(FrameTimings[Index].X);
+        TotalMs += FrameTimings[Index].X;
+    }
+
+    const FString TimingFile = FPaths::ChangeExtension(Filename, TEXT("")) + TEXT("_timing.csv");
+    FFileHelper::SaveStringArrayToFile(CsvLines, *TimingFile);
+
+    FrameTimes.Sort();
+    const int32 NumTimes = FrameTimes.Num();
+    UE_LOG(LogTrinityFlowCombat, Display, TEXT("Combat replay: %d frames, avg %.2f ms, p95 %.2f ms, max %.2f ms, timing written to %s"),
+        NumTimes,
+        NumTimes > 0 ? TotalMs / NumTimes : 0.0,
+        NumTimes > 0 ? FrameTimes[FMath::Min(NumTimes - 1, NumTimes * 95 / 100)] : 0.0f,
+        NumTimes > 0 ? FrameTimes.Last() : 0.0f,
+        *TimingFile);
+    UE_LOG(LogTrinityFlowCombat, Display, TEXT("Combat replay: state hash %08x, recorded %08x (%s), %d spawn desyncs"),
+        StateHash, RecordedStateHash, StateHash == RecordedStateHash ? TEXT("match") : TEXT("MISMATCH"), Desyncs);
+
+    if (bExitWhenDone)
+    {
+        FPlatformMisc::RequestExit(false, TEXT("CombatReplay"));
+    }
+}
+
+uint32 UCombatReplaySubsystem::ComputeStateHash() const
+{
+    const UWorld* World = GetWorld();
+    if (!World)
+    {
+        return 0;
+    }
+
+    // Hash each pawn on its own and sort, so actor iteration order does not matter
+    TArray<uint32> PawnHashes;
+    for (TActorIterator<APawn> It(World); It; ++It)
+    {
+        const APawn* Pawn = *It;
+        if (Pawn->IsActorBeingDestroyed())
+        {
+            continue;
+        }
+
+        const FIntVector Location = FIntVector(Pawn->GetActorLocation().GridSnap(1.0));
+        uint32 Hash = HashCombine(GetTypeHash(Pawn->GetClass()->GetFName()), GetTypeHash(Location));
+
+        if (const UHealthComponent* Health = UCombatantHandleSubsystem::Get(Pawn).Health.Get())
+        {
+            Hash = HashCombine(Hash, GetTypeHash(FMath::RoundToInt(Health->GetHealth() * 100.0f)));
+        }
+        PawnHashes.Add(Hash);
+    }
+    PawnHashes.Sort();
+
+    uint32 StateHash = FCrc::MemCrc32(PawnHashes.GetData(), PawnHashes.Num() * sizeof(uint32));
+    if (const UEnemyHordeSubsystem* Horde = World->GetSubsystem<UEnemyHordeSubsystem>())
+    {
+        StateHash = HashCombine(StateHash, GetTypeHash(Horde->GetNumEntities()));
+    }
+    return StateHash;
+}
+
+void UCombatReplaySubsystem::SerializeEvents(FArchive& Ar)
+{
+    // Frames are stored as packed deltas; digital actions carry no value
+    int32 NumInputs = InputEvents.Num();
+    Ar << NumInputs;
+    if (Ar.IsLoading())
+    {
+        InputEvents.SetNum(NumInputs);
+    }
+
+    uint32 PreviousFrame = 0;
+    for (FReplayInputEvent& Event : InputEvents)
+    {
+        uint32 FrameDelta = Event.Frame - PreviousFrame;
+        Ar.SerializeIntPacked(FrameDelta);
+        Event.Frame = PreviousFrame + FrameDelta;
+        PreviousFrame = Event.Frame;
+
+        uint8 Action = static_cast<uint8>(Event.Action);
+        Ar << Action;
+        Event.Action = static_cast<EReplayInputAction>(FMath::Min<uint8>(Action, static_cast<uint8>(EReplayInputAction::Count) - 1));
+
+        if (IsAxisAction(Event.Action))
+        {
+            Ar << Event.Value;
+        }
+    }
+
+    int32 NumSpawns = SpawnEvents.Num();
+    Ar << NumSpawns;
+    if (Ar.IsLoading())
+    {
+        SpawnEvents.SetNum(NumSpawns);
+    }
+
+    PreviousFrame = 0;
+    for (FReplaySpawnEvent& Event : SpawnEvents)
+    {
+        uint32 FrameDelta = Event.Frame - PreviousFrame;
+        Ar.SerializeIntPacked(FrameDelta);
+        Event.Frame = PreviousFrame + FrameDelta;
+        PreviousFrame = Event.Frame;
+
+        Ar << Event.EnemyType;
+        Ar << Event.Count;
+        Ar << Event.Location;
+    }
+}
+
+bool UCombatReplaySubsystem::SaveRecording()
+{
+    TArray<uint8> Data;
+    FMemoryWriter Writer(Data);
+
+    uint32 Magic = CombatReplay::FileMagic;
+    uint32 Version = CombatReplay::FileVersion;
+    FString MapName = RecordedMapName;
+    int32 SavedSeed = Seed;
+    float SavedDeltaTime = FixedDeltaTime;
+    uint32 SavedNumFrames = NumFrames;
+    uint32 SavedStateHash = RecordedStateHash;
+
+    Writer << Magic << Version << MapName << SavedSeed << SavedDeltaTime << SavedNumFrames << SavedStateHash;
+    SerializeEvents(Writer);
+
+    return FFileHelper::SaveArrayToFile(Data, *Filename);
+}
+
+bool UCombatReplaySubsystem::LoadRecording(const FString& InFilename)
+{
+    TArray<uint8> Data;
+    if (!FFileHelper::LoadFileToArray(Data, *InFilename))
+    {
+        return false;
+    }
+
+    FMemoryReader Reader(Data);
+
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    Reader << Magic << Version;
+    if (Magic != CombatReplay::FileMagic || Version != CombatReplay::FileVersion)
+    {
+        return false;
+    }
+
+    Reader << RecordedMapName << Seed << FixedDeltaTime << NumFrames << RecordedStateHash;
+    SerializeEvents(Reader);
+
+    if (Reader.IsError() || FixedDeltaTime <= 0.0f)
+    {
+        InputEvents.Reset();
+        SpawnEvents.Reset();
+        return false;
+    }
+
+    Filename = InFilename;
+    return true;
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorld ReplayStopRecordingCommand(
+    TEXT("TrinityFlow.Replay.StopRecording"),
+    TEXT("Stops the input recording started with -CombatRecord and writes it to Saved/CombatReplays"),
+    FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+    {
+        if (UCombatReplaySubsystem* Replay = UCombatReplaySubsystem::Get(World))
+        {
+            Replay->StopRecording();
+        }
+    }));
+
+static FAutoConsoleCommandWithWorld ReplayStatusCommand(
+    TEXT("TrinityFlow.Replay.Status"),
+    TEXT("Logs whether input is being recorded or replayed and the current replay frame"),
+    FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+    {
+        if (const UCombatReplaySubsystem* Replay = UCombatReplaySubsystem::Get(World))
+        {
+            UE_LOG(LogTrinityFlowCombat, Log, TEXT("Combat replay: %s, frame %u, state hash %08x"),
+                Replay->IsRecording() ? TEXT("recording") : Replay->IsReplaying() ? TEXT("replaying") : TEXT("idle"),
+                Replay->GetFrameIndex(), Replay->ComputeStateHash());
+        }
+    }));
+#endif
@@ -0,0 +1,221 @@
+#include "Core/CombatResolutionSubsystem.h"
+#include "Core/TrinityFlowProfiling.h"
+#include "Core/CombatEventRecorder.h"
+#include "Core/HealthComponent.h"
+#include "Core/CombatAttributeSubsystem.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+void UCombatResolutionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    PendingRequests.Reserve(64);
+    ResolvingRequests.Reserve(64);
+}
+
+void UCombatResolutionSubsystem::Deinitialize()
+{
+    PendingRequests.Empty();
+    ResolvingRequests.Empty();
+    TargetOrder.Empty();
+    TargetIndices.Empty();
+    TargetEvents.Empty();
+    DamageResponseCache.Reset();
+    EventBus.Reset();
+
+    Super::Deinitialize();
+}
+
+void UCombatResolutionSubsystem::Tick(float DeltaTime)
+{
+    RequestsResolvedLastFrame = 0;
+    TargetsResolvedLastFrame = 0;
+    PassesLastFrame = 0;
+
+    ResolvePendingDamage();
+
+    TRINITYFLOW_INC_COUNTER(DamageRequests, RequestsResolvedLastFrame);
+}
+
+TStatId UCombatResolutionSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatResolutionSubsystem, STATGROUP_TrinityFlow);
+}
+
+void UCombatResolutionSubsystem::SubmitDamage(UHealthComponent* Target, const FDamageInfo& DamageInfo, const FVector& DamageDirection)
+{
+    if (!Target)
+    {
+        return;
+    }
+
+    PendingRequests.Emplace(Target, DamageInfo, DamageDirection);
+}
+
+void UCombatResolutionSubsystem::ResolvePendingDamage()
+{
+    TRINITYFLOW_SCOPE_CYCLE_COUNTER(DamageResolution);
+
+    // Re-entrant submissions (echo damage) are picked up by the next pass of the loop below
+    if (bIsResolving)
+    {
+        return;
+    }
+
+    bIsResolving = true;
+
+    int32 Pass = 0;
+    while (PendingRequests.Num() > 0 && Pass < MaxResolvePasses)
+    {
+        ResolvePass();
+        Pass++;
+    }
+
+    if (PendingRequests.Num() > 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("CombatResolution: Dropping %d damage requests after %d passes"), PendingRequests.Num(), Pass);
+        PendingRequests.Reset();
+    }
+
+    PassesLastFrame += Pass;
+    bIsResolving = false;
+
+    // Batched listeners (UI) see the whole frame's events at once
+    EventBus.Flush();
+}
+
+FCombatEventBus* UCombatResolutionSubsystem::GetEventBus(const UObject* WorldContextObject)
+{
+    UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    UCombatResolutionSubsystem* Resolution = World ? World->GetSubsystem<UCombatResolutionSubsystem>() : nullptr;
+    return Resolution ? &Resolution->EventBus : nullptr;
+}
+
+void UCombatResolutionSubsystem::ResolvePass()
+{
+    // Take ownership of the queue so that anything submitted during broadcasts lands in the next pass
+    Swap(ResolvingRequests, PendingRequests);
+    PendingRequests.Reset();
+
+    TargetOrder.Reset();
+    TargetIndices.Reset();
+
+    // Gather the hits against living targets into one SoA batch. Defence and tags do not change
+    // during resolution, so every hit's final damage can be computed up front in one kernel.
+    DamageBatch.Reset(ResolvingRequests.Num());
+    BatchRequestIndices.Reset(ResolvingRequests.Num());
+
+    UCombatAttributeSubsystem* Attributes = GetWorld()->GetSubsystem<UCombatAttributeSubsystem>();
+
+    for (int32 RequestIndex = 0; RequestIndex < ResolvingRequests.Num(); RequestIndex++)
+    {
+        const FDamageRequest& Request = ResolvingRequests[RequestIndex];
+        UHealthComponent* Target = Request.Target.Get();
+        AActor* Owner = Target ? Target->GetOwner() : nullptr;
+        if (!Owner || !Target->IsAlive())
+        {
+            continue;
+        }
+
+        // Cached defence and tags; rebuilt only when the target's resources or tags changed
+        if (Attributes)
+        {
+            const FCombatAttributes& TargetAttributes = Attributes->Find(Owner);
+            DamageBatch.Add(Request.DamageInfo, TargetAttributes.Defence, TargetAttributes.DamageTags,
+                Request.DamageDirection, Owner->GetActorForwardVector());
+        }
+        else
+        {
+            DamageBatch.Add(Request.DamageInfo, Target->GetResources().DefencePoint, Target->GetDamageTags(),
+                Request.DamageDirection, Owner->GetActorForwardVector());
+        }
+        BatchRequestIndices.Add(RequestIndex);
+    }
+
+    BatchDamage.SetNumUninitialized(DamageBatch.Num(), EAllowShrinking::No);
+    FDamageCalculator::CalculateDamageBatch(DamageBatch, BatchDamage,
+        FDamageCalculator::IsResponseCacheEnabled() ? &DamageResponseCache : nullptr);
+
+    // Apply all hits in submission order, grouping the resulting events by target
+    for (int32 BatchIndex = 0; BatchIndex < BatchRequestIndices.Num(); BatchIndex++)
+    {
+        const FDamageRequest& Request = ResolvingRequests[BatchRequestIndices[BatchIndex]];
+        UHealthComponent* Target = Request.Target.Get();
+
+        const float ActualDamage = Target->ApplyFinalDamage(BatchDamage[BatchIndex]);
+        TRINITYFLOW_RECORD_COMBAT(DamageApplied, Request.DamageInfo.Instigator, Target->GetOwner(),
+            ActualDamage, Request.DamageInfo.Amount, static_cast<uint8>(Request.DamageInfo.Type));
+        if (ActualDamage <= 0.0f)
+        {
+            continue;
+        }
+
+        int32 TargetIndex;
+        if (const int32* FoundIndex = TargetIndices.Find(Target))
+        {
+            TargetIndex = *FoundIndex;
+        }
+        else
+        {
+            TargetIndex = TargetOrder.Add(Target);
+            TargetIndices.Add(Target, TargetIndex);
+
+            if (TargetEvents.Num() <= TargetIndex)
+            {
+                TargetEvents.SetNum(TargetIndex + 1);
+            }
+            TargetEvents[TargetIndex].Reset();
+        }
+
+        // Coalesce hits from the same instigator and damage type
+        TArray<FResolvedDamageEvent>& Events = TargetEvents[TargetIndex];
+        FResolvedDamageEvent* Existing = Events.FindByPredicate([&Request](const FResolvedDamageEvent& Event)
+        {
+            return Event.Instigator == Request.DamageInfo.Instigator && Event.Type == Request.DamageInfo.Type;
+        });
+
+        if (Existing)
+        {
+            Existing->ActualDamage += ActualDamage;
+            Existing->bIsLeftWeapon = Request.DamageInfo.bIsLeftWeapon;
+        }
+        else
+        {
+            FResolvedDamageEvent& NewEvent = Events.AddDefaulted_GetRef();
+            NewEvent.Instigator = Request.DamageInfo.Instigator;
+            NewEvent.Type = Request.DamageInfo.Type;
+            NewEvent.ActualDamage = ActualDamage;
+            NewEvent.bIsLeftWeapon = Request.DamageInfo.bIsLeftWeapon;
+        }
+    }
+
+    RequestsResolvedLastFrame += ResolvingRequests.Num();
+    TargetsResolvedLastFrame += TargetOrder.Num();
+    ResolvingRequests.Reset();
+
+    // Broadcast once per target
+    for (int32 TargetIndex = 0; TargetIndex < TargetOrder.Num(); TargetIndex++)
+    {
+        if (IsValid(TargetOrder[TargetIndex]))
+        {
+            TargetOrder[TargetIndex]->BroadcastResolvedDamage(TargetEvents[TargetIndex]);
+        }
+    }
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorld DamageCacheStatsCommand(
+    TEXT("TrinityFlow.Damage.CacheStats"),
+    TEXT("Logs hit/miss counters of the damage response cache"),
+    FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+    {
+        if (UCombatResolutionSubsystem* Resolution = World ? World->GetSubsystem<UCombatResolutionSubsystem>() : nullptr)
+        {
+            const FDamageResponseCache& Cache = Resolution->GetDamageResponseCache();
+            const uint64 Lookups = Cache.GetHits() + Cache.GetMisses();
+            UE_LOG(LogTemp, Log, TEXT("Damage response cache: %d entries, %llu hits, %llu misses (%.1f%% hit rate)"),
+                Cache.Num(), Cache.GetHits(), Cache.GetMisses(), Lookups > 0 ? 100.0 * Cache.GetHits() / Lookups : 0.0);
+        }
+    }));
+#endif
@@ -0,0 +1,346 @@
+#include "Core/CombatSpatialGridSubsystem.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+
+#if !UE_BUILD_SHIPPING
+#include "Components/SphereComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/OverlapResult.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#endif
+
+void UCombatSpatialGridSubsystem::Deinitialize()
+{
+    for (const FGridEntry& Entry : Entries)
+    {
+        if (Entry.bInUse)
+        {
+            if (AActor* Actor = Entry.Actor.Get())
+            {
+                if (USceneComponent* Root = Actor->GetRootComponent())
+                {
+                    Root->TransformUpdated.Remove(Entry.TransformHandle);
+                }
+            }
+        }
+    }
+
+    Entries.Empty();
+    FreeEntries.Empty();
+    EntryIndices.Empty();
+    Cells.Empty();
+
+    Super::Deinitialize();
+}
+
+FIntPoint UCombatSpatialGridSubsystem::GetCell(const FVector& Location)
+{
+    return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void UCombatSpatialGridSubsystem::Register(AActor* Actor)
+{
+    USceneComponent* Root = Actor ? Actor->GetRootComponent() : nullptr;
+    if (!Root || EntryIndices.Contains(Actor))
+    {
+        return;
+    }
+
+    const int32 EntryIndex = FreeEntries.Num() > 0 ? FreeEntries.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+    EntryIndices.Add(Actor, EntryIndex);
+
+    FGridEntry& Entry = Entries[EntryIndex];
+    Entry.Actor = Actor;
+    Entry.Location = Actor->GetActorLocation();
+    Entry.Radius = Actor->GetSimpleCollisionRadius();
+    MaxEntryRadius = FMath::Max(MaxEntryRadius, Entry.Radius);
+    Entry.Cell = GetCell(Entry.Location);
+    Entry.bInUse = true;
+    Entry.TransformHandle = Root->TransformUpdated.AddUObject(this, &UCombatSpatialGridSubsystem::OnTransformUpdated);
+
+    Cells.FindOrAdd(Entry.Cell).Add(EntryIndex);
+
+    Actor->OnEndPlay.AddUniqueDynamic(this, &UCombatSpatialGridSubsystem::OnActorEndPlay);
+}
+
+void UCombatSpatialGridSubsystem::Unregister(AActor* Actor)
+{
+    int32 EntryIndex;
+    if (!EntryIndices.RemoveAndCopyValue(Actor, EntryIndex))
+    {
+        return;
+    }
+
+    FGridEntry& Entry = Entries[EntryIndex];
+    if (USceneComponent* Root = Actor->GetRootComponent())
+    {
+        Root->TransformUpdated.Remove(Entry.TransformHandle);
+    }
+    Actor->OnEndPlay.RemoveDynamic(this, &UCombatSpatialGridSubsystem::OnActorEndPlay);
+
+    RemoveFromCell(EntryIndex);
+    Entry = FGridEntry();
+    FreeEntries.Add(EntryIndex);
+}
+
+void UCombatSpatialGridSubsystem::OnActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+    Unregister(Actor);
+}
+
+void UCombatSpatialGridSubsystem::OnTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+    if (const int32* EntryIndex = EntryIndices.Find(UpdatedComponent->GetOwner()))
+    {
+        MoveEntry(*EntryIndex, UpdatedComponent->GetComponentLocation());
+    }
+}
+
+void UCombatSpatialGridSubsystem::MoveEntry(int32 EntryIndex, const FVector& NewLocation)
+{
+    FGridEntry& Entry = Entries[EntryIndex];
+    Entry.Location = NewLocation;
+
+    // Most moves stay inside the same cell
+    const FIntPoint NewCell = GetCell(NewLocation);
+    if (NewCell != Entry.Cell)
+    {
+        RemoveFromCell(EntryIndex);
+        Entry.Cell = NewCell;
+        Cells.FindOrAdd(NewCell).Add(EntryIndex);
+    }
+}
+
+void UCombatSpatialGridSubsystem::RemoveFromCell(int32 EntryIndex)
+{
+    const FIntPoint Cell = Entries[EntryIndex].Cell;
+    if (TArray<int32>* CellEntries = Cells.Find(Cell))
+    {
+        CellEntries->RemoveSingleSwap(EntryIndex, EAllowShrinking::No);
+        if (CellEntries->Num() == 0)
+        {
+            Cells.Remove(Cell);
+        }
+    }
+}
+
+template<typename VisitorType>
+void UCombatSpatialGridSubsystem::ForEachInRadius(const FVector& Center, float Radius, const AActor* IgnoreActor, VisitorType&& Visitor) const
+{
+    // Entries are bucketed by their centre, so widen the scan by the largest collision radius we hold
+    const float ScanRadius = Radius + MaxEntryRadius;
+    const FIntPoint MinCell = GetCell(Center - FVector(ScanRadius, ScanRadius, 0.0f));
+    const FIntPoint MaxCell = GetCell(Center + FVector(ScanRadius, ScanRadius, 0.0f));
+
+    for (int32 CellX = MinCell.X; CellX <= MaxCell.X; CellX++)
+    {
+        for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; CellY++)
+        {
+            const TArray<int32>* CellEntries = Cells.Find(FIntPoint(CellX, CellY));
+            if (!CellEntries)
+            {
+                continue;
+            }
+
+            for (const int32 EntryIndex : *CellEntries)
+            {
+                const FGridEntry& Entry = Entries[EntryIndex];
+                const float ReachSq = FMath::Square(Radius + Entry.Radius);
+                const float DistanceSq = FVector::DistSquared(Center, Entry.Location);
+                if (DistanceSq > ReachSq)
+                {
+                    continue;
+                }
+
+                AActor* Actor = Entry.Actor.Get();
+                if (Actor && Actor != IgnoreActor)
+                {
+                    Visitor(Actor, Entry.Location);
+                }
+            }
+        }
+    }
+}
+
+void UCombatSpatialGridSubsystem::QueryRadius(const FVector& Center, float Radius, TArray<AActor*>& OutActors, const AActor* IgnoreActor) const
+{
+    OutActors.Reset();
+    ForEachInRadius(Center, Radius, IgnoreActor, [&OutActors](AActor* Actor, const FVector& Location)
+    {
+        OutActors.Add(Actor);
+    });
+}
+
+void UCombatSpatialGridSubsystem::QueryCone(const FVector& Origin, const FVector& Direction, float Radius, float HalfAngleDegrees, TArray<AActor*>& OutActors, const AActor* IgnoreActor) const
+{
+    OutActors.Reset();
+
+    const FVector ConeDirection = Direction.GetSafeNormal();
+    const float MinCos = FMath::Cos(FMath::DegreesToRadians(HalfAngleDegrees));
+
+    ForEachInRadius(Origin, Radius, IgnoreActor, [&](AActor* Actor, const FVector& Location)
+    {
+        const FVector ToActor = (Location - Origin).GetSafeNormal();
+        if (ToActor.IsZero() || FVector::DotProduct(ToActor, ConeDirection) >= MinCos)
+        {
+            OutActors.Add(Actor);
+        }
+    });
+}
+
+void UCombatSpatialGridSubsystem::QueryNearest(const FVector& Location, int32 Count, float MaxRadius, TArray<AActor*>& OutActors, const AActor* IgnoreActor) const
+{
+    OutActors.Reset();
+    if (Count <= 0)
+    {
+        return;
+    }
+
+    struct FCandidate
+    {
+        AActor* Actor;
+        float DistanceSq;
+    };
+
+    TArray<FCandidate, TInlineAllocator<16>> Candidates;
+    const FIntPoint CenterCell = GetCell(Location);
+    const int32 MaxRing = FMath::CeilToInt32(MaxRadius / CellSize) + 1;
+    const float MaxRadiusSq = FMath::Square(MaxRadius);
+
+    // Grow square rings of cells until the K-th candidate is closer than anything in an unvisited ring
+    for (int32 Ring = 0; Ring <= MaxRing; Ring++)
+    {
+        for (int32 CellX = CenterCell.X - Ring; CellX <= CenterCell.X + Ring; CellX++)
+        {
+            for (int32 CellY = CenterCell.Y - Ring; CellY <= CenterCell.Y + Ring; CellY++)
+            {
+                if (FMath::Max(FMath::Abs(CellX - CenterCell.X), FMath::Abs(CellY - CenterCell.Y)) != Ring)
+                {
+                    continue;
+                }
+
+                const TArray<int32>* CellEntries = Cells.Find(FIntPoint(CellX, CellY));
+                if (!CellEntries)
+                {
+                    continue;
+                }
+
+                for (const int32 EntryIndex : *CellEntries)
+                {
+                    const FGridEntry& Entry = Entries[EntryIndex];
+                    const float DistanceSq = FVector::DistSquared(Location, Entry.Location);
+                    AActor* Actor = Entry.Actor.Get();
+                    if (Actor && Actor != IgnoreActor && DistanceSq <= MaxRadiusSq)
+                    {
+                        Candidates.Add({ Actor, DistanceSq });
+                    }
+                }
+            }
+        }
+
+        if (Candidates.Num() >= Count)
+        {
+            Candidates.Sort([](const FCandidate& A, const FCandidate& B) { return A.DistanceSq < B.DistanceSq; });
+            if (Candidates[Count - 1].DistanceSq <= FMath::Square(Ring * CellSize))
+            {
+                break;
+            }
+        }
+    }
+
+    Candidates.Sort([](const FCandidate& A, const FCandidate& B) { return A.DistanceSq < B.DistanceSq; });
+    for (int32 Index = 0; Index < FMath::Min(Count, Candidates.Num()); Index++)
+    {
+        OutActors.Add(Candidates[Index].Actor);
+    }
+}
+
+#if !UE_BUILD_SHIPPING
+namespace
+{
+    // Compares grid radius queries against the OverlapMultiByChannel path used for area damage
+    void RunSpatialGridBenchmark(UWorld* World, int32 NumQueries)
+    {
+        UCombatSpatialGridSubsystem* Grid = World ? World->GetSubsystem<UCombatSpatialGridSubsystem>() : nullptr;
+        if (!Grid)
+        {
+            return;
+        }
+
+        const float QueryRadius = 400.0f;
+        const float ArenaHalfSize = 3000.0f;
+        const int32 ActorCounts[] = { 50, 200, 500 };
+
+        for (const int32 NumActors : ActorCounts)
+        {
+            FRandomStream Random(NumActors);
+            TArray<AActor*> BenchmarkActors;
+
+            FActorSpawnParameters SpawnParams;
+            SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+            for (int32 Index = 0; Index < NumActors; Index++)
+            {
+                const FVector Location(Random.FRandRange(-ArenaHalfSize, ArenaHalfSize), Random.FRandRange(-ArenaHalfSize, ArenaHalfSize), 100000.0f);
+                AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Location), SpawnParams);
+
+                USphereComponent* Sphere = NewObject<USphereComponent>(Actor);
+                Sphere->InitSphereRadius(40.0f);
+                Sphere->SetCollisionProfileName(UCollisionProfile::Pawn_ProfileName);
+                Actor->SetRootComponent(Sphere);
+                Sphere->RegisterComponent();
+                Actor->SetActorLocation(Location);
+
+                Grid->Register(Actor);
+                BenchmarkActors.Add(Actor);
+            }
+
+            TArray<FVector> Centers;
+            for (int32 Query = 0; Query < NumQueries; Query++)
+            {
+                Centers.Add(FVector(Random.FRandRange(-ArenaHalfSize, ArenaHalfSize), Random.FRandRange(-ArenaHalfSize, ArenaHalfSize), 100000.0f));
+            }
+
+            int64 OverlapHits = 0;
+            TArray<FOverlapResult> OverlapResults;
+            const double OverlapStart = FPlatformTime::Seconds();
+            for (const FVector& Center : Centers)
+            {
+                World->OverlapMultiByChannel(OverlapResults, Center, FQuat::Identity, ECC_Pawn, FCollisionShape::MakeSphere(QueryRadius));
+                OverlapHits += OverlapResults.Num();
+            }
+            const double OverlapSeconds = FPlatformTime::Seconds() - OverlapStart;
+
+            int64 GridHits = 0;
+            TArray<AActor*> GridResults;
+            const double GridStart = FPlatformTime::Seconds();
+            for (const FVector& Center : Centers)
+            {
+                Grid->QueryRadius(Center, QueryRadius, GridResults);
+                GridHits += GridResults.Num();
+            }
+            const double GridSeconds = FPlatformTime::Seconds() - GridStart;
+
+            UE_LOG(LogTemp, Log, TEXT("SpatialGrid benchmark %d actors, %d queries: overlap %.3f ms (%lld hits), grid %.3f ms (%lld hits), %.1fx"),
+                NumActors, NumQueries, OverlapSeconds * 1000.0, OverlapHits, GridSeconds * 1000.0, GridHits,
+                GridSeconds > 0.0 ? OverlapSeconds / GridSeconds : 0.0);
+
+            for (AActor* Actor : BenchmarkActors)
+            {
+                Actor->Destroy();
+            }
+        }
+    }
+}
+
+static FAutoConsoleCommandWithWorldAndArgs SpatialGridBenchmarkCommand(
+    TEXT("TrinityFlow.Spatial.Benchmark"),
+    TEXT("Times grid radius queries against sphere overlaps at 50/200/500 actors. Args: [NumQueries]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        const int32 NumQueries = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1000;
+        RunSpatialGridBenchmark(World, FMath::Max(1, NumQueries));
+    }));
+#endif
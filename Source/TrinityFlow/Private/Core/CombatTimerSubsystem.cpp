@@ -0,0 +1,249 @@
+#include "Core/CombatTimerSubsystem.h"
+#include "Core/TrinityFlowProfiling.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+void UCombatTimerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    CurrentSlot = TimeToSlot(GetNow());
+}
+
+void UCombatTimerSubsystem::Deinitialize()
+{
+    ExpiryTimes.Empty();
+    Serials.Empty();
+    Callbacks.Empty();
+    ActiveTimers.Empty();
+    FreeIndices.Empty();
+
+    for (TArray<FWheelEntry>& Slot : NearSlots)
+    {
+        Slot.Empty();
+    }
+    for (TArray<FWheelEntry>& Slot : FarSlots)
+    {
+        Slot.Empty();
+    }
+    Overflow.Empty();
+    NumActiveTimers = 0;
+
+    Super::Deinitialize();
+}
+
+TStatId UCombatTimerSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatTimerSubsystem, STATGROUP_TrinityFlow);
+}
+
+UCombatTimerSubsystem* UCombatTimerSubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UCombatTimerSubsystem>() : nullptr;
+}
+
+double UCombatTimerSubsystem::GetNow() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0;
+}
+
+int64 UCombatTimerSubsystem::TimeToSlot(double Time)
+{
+    return FMath::FloorToInt64(Time / SlotDuration);
+}
+
+bool UCombatTimerSubsystem::IsCurrent(const FWheelEntry& Entry) const
+{
+    return ActiveTimers[Entry.Index] && Serials[Entry.Index] == Entry.Serial;
+}
+
+void UCombatTimerSubsystem::SetTimer(FCombatTimerHandle& Handle, float Duration, FSimpleDelegate Callback)
+{
+    ClearTimer(Handle);
+
+    if (Duration <= 0.0f)
+    {
+        return;
+    }
+
+    int32 Index;
+    if (FreeIndices.Num() > 0)
+    {
+        Index = FreeIndices.Pop(EAllowShrinking::No);
+    }
+    else
+    {
+        Index = ExpiryTimes.AddUninitialized();
+        Serials.Add(1);
+        Callbacks.AddDefaulted();
+        ActiveTimers.Add(false);
+    }
+
+    ExpiryTimes[Index] = GetNow() + Duration;
+    Callbacks[Index] = MoveTemp(Callback);
+    ActiveTimers[Index] = true;
+    NumActiveTimers++;
+
+    Handle.Index = Index;
+    Handle.Serial = Serials[Index];
+
+    FWheelEntry Entry;
+    Entry.Index = Index;
+    Entry.Serial = Serials[Index];
+    Insert(Entry);
+}
+
+void UCombatTimerSubsystem::ClearTimer(FCombatTimerHandle& Handle)
+{
+    if (IsTimerActive(Handle))
+    {
+        Release(Handle.Index);
+    }
+
+    Handle.Invalidate();
+}
+
+bool UCombatTimerSubsystem::IsTimerActive(const FCombatTimerHandle& Handle) const
+{
+    return Handle.IsValid() && ActiveTimers.IsValidIndex(Handle.Index) && ActiveTimers[Handle.Index] && Serials[Handle.Index] == Handle.Serial;
+}
+
+float UCombatTimerSubsystem::GetTimeRemaining(const FCombatTimerHandle& Handle) const
+{
+    if (!IsTimerActive(Handle))
+    {
+        return 0.0f;
+    }
+
+    return FMath::Max(0.0f, static_cast<float>(ExpiryTimes[Handle.Index] - GetNow()));
+}
+
+void UCombatTimerSubsystem::Release(int32 Index)
+{
+    // Bumping the serial invalidates outstanding handles and wheel entries for this record
+    ActiveTimers[Index] = false;
+    Serials[Index]++;
+    Callbacks[Index].Unbind();
+    FreeIndices.Add(Index);
+    NumActiveTimers--;
+}
+
+void UCombatTimerSubsystem::Insert(const FWheelEntry& Entry)
+{
+    const int64 ExpirySlot = FMath::Max(FMath::CeilToInt64(ExpiryTimes[Entry.Index] / SlotDuration), CurrentSlot + 1);
+    const int64 SlotsAhead = ExpirySlot - CurrentSlot;
+
+    if (SlotsAhead < NumNearSlots)
+    {
+        NearSlots[ExpirySlot & (NumNearSlots - 1)].Add(Entry);
+    }
+    else if (SlotsAhead < NumNearSlots * NumFarSlots)
+    {
+        FarSlots[(ExpirySlot >> NearSlotBits) & (NumFarSlots - 1)].Add(Entry);
+    }
+    else
+    {
+        Overflow.Add(Entry);
+    }
+}
+
+void UCombatTimerSubsystem::Tick(float DeltaTime)
+{
+    FiredLastFrame = 0;
+    SlotsVisitedLastFrame = 0;
+
+    const double Now = GetNow();
+    const int64 TargetSlot = TimeToSlot(Now);
+
+    // Nothing scheduled: leftover entries are stale and skipped whenever their slot comes round
+    if (NumActiveTimers == 0)
+    {
+        CurrentSlot = FMath::Max(CurrentSlot, TargetSlot);
+        return;
+    }
+
+    while (CurrentSlot < TargetSlot)
+    {
+        ProcessSlot(++CurrentSlot, Now);
+        SlotsVisitedLastFrame++;
+    }
+}
+
+void UCombatTimerSubsystem::ProcessSlot(int64 Slot, double Now)
+{
+    if ((Slot & (NumNearSlots - 1)) == 0)
+    {
+        // Entering a new block of near slots: spread the matching far slot over it
+        TArray<FWheelEntry>& FarSlot = FarSlots[(Slot >> NearSlotBits) & (NumFarSlots - 1)];
+        for (const FWheelEntry& Entry : FarSlot)
+        {
+            if (IsCurrent(Entry))
+            {
+                const int64 ExpirySlot = FMath::Max(FMath::CeilToInt64(ExpiryTimes[Entry.Index] / SlotDuration), Slot);
+                NearSlots[ExpirySlot & (NumNearSlots - 1)].Add(Entry);
+            }
+        }
+        FarSlot.Reset();
+
+        // Once per full turn of the far wheel, pull overflow timers that now fit
+        if (((Slot >> NearSlotBits) & (NumFarSlots - 1)) == 0 && Overflow.Num() > 0)
+        {
+            TArray<FWheelEntry> Pending = MoveTemp(Overflow);
+            for (const FWheelEntry& Entry : Pending)
+            {
+                if (IsCurrent(Entry))
+                {
+                    Insert(Entry);
+                }
+            }
+        }
+    }
+
+    TArray<FWheelEntry>& NearSlot = NearSlots[Slot & (NumNearSlots - 1)];
+    if (NearSlot.Num() == 0)
+    {
+        return;
+    }
+
+    Swap(FiringEntries, NearSlot);
+
+    for (const FWheelEntry& Entry : FiringEntries)
+    {
+        if (!IsCurrent(Entry))
+        {
+            continue;
+        }
+
+        if (ExpiryTimes[Entry.Index] > Now)
+        {
+            Insert(Entry);
+            continue;
+        }
+
+        // Free the record first so the callback can start a new timer with the same handle
+        FSimpleDelegate Callback = MoveTemp(Callbacks[Entry.Index]);
+        Release(Entry.Index);
+        FiredLastFrame++;
+
+        Callback.ExecuteIfBound();
+    }
+
+    FiringEntries.Reset();
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorld TimerStatsCommand(
+    TEXT("TrinityFlow.Timers.Stats"),
+    TEXT("Logs active combat timers and timing wheel work done last frame"),
+    FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+    {
+        if (UCombatTimerSubsystem* Timers = World ? World->GetSubsystem<UCombatTimerSubsystem>() : nullptr)
+        {
+            UE_LOG(LogTemp, Log, TEXT("Combat timers: %d active of %d records, %d fired and %d slots visited last frame"),
+                Timers->GetNumActiveTimers(), Timers->GetNumTimerRecords(),
+                Timers->GetFiredLastFrame(), Timers->GetSlotsVisitedLastFrame());
+        }
+    }));
+#endif
@@ -0,0 +1,95 @@
+#include "Core/CombatantHandleSubsystem.h"
+#include "Core/HealthComponent.h"
+#include "Core/TagComponent.h"
+#include "Core/StateComponent.h"
+#include "Core/ShardComponent.h"
+#include "Core/StanceComponent.h"
+#include "Core/AnimationComponent.h"
+#include "Enemy/EnemyAnimationComponent.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+
+void FCombatantHandles::Resolve(const AActor* Actor)
+{
+    *this = FCombatantHandles();
+
+    if (!Actor)
+    {
+        return;
+    }
+
+    Health = Actor->FindComponentByClass<UHealthComponent>();
+    Tags = Actor->FindComponentByClass<UTagComponent>();
+    State = Actor->FindComponentByClass<UStateComponent>();
+    Shard = Actor->FindComponentByClass<UShardComponent>();
+    Stance = Actor->FindComponentByClass<UStanceComponent>();
+    Animation = Actor->FindComponentByClass<UAnimationComponent>();
+    EnemyAnimation = Actor->FindComponentByClass<UEnemyAnimationComponent>();
+}
+
+void UCombatantHandleSubsystem::Deinitialize()
+{
+    Handles.Empty();
+    Super::Deinitialize();
+}
+
+const FCombatantHandles& UCombatantHandleSubsystem::Register(AActor* Actor)
+{
+    if (!Actor)
+    {
+        TransientHandles = FCombatantHandles();
+        return TransientHandles;
+    }
+
+    FCombatantHandles& Entry = Handles.FindOrAdd(Actor);
+    Entry.Resolve(Actor);
+
+    Actor->OnEndPlay.AddUniqueDynamic(this, &UCombatantHandleSubsystem::OnActorEndPlay);
+    return Entry;
+}
+
+void UCombatantHandleSubsystem::Unregister(AActor* Actor)
+{
+    if (Actor)
+    {
+        Handles.Remove(Actor);
+        Actor->OnEndPlay.RemoveDynamic(this, &UCombatantHandleSubsystem::OnActorEndPlay);
+    }
+}
+
+const FCombatantHandles& UCombatantHandleSubsystem::Find(const AActor* Actor)
+{
+    if (const FCombatantHandles* Found = Handles.Find(Actor))
+    {
+        return *Found;
+    }
+
+    // Only actors in play are registered; anything else is resolved into scratch storage
+    if (Actor && (Actor->HasActorBegunPlay() || Actor->IsActorBeginningPlay()) && !Actor->IsActorBeingDestroyed())
+    {
+        return Register(const_cast<AActor*>(Actor));
+    }
+
+    TransientHandles.Resolve(Actor);
+    return TransientHandles;
+}
+
+const FCombatantHandles& UCombatantHandleSubsystem::Get(const AActor* Actor)
+{
+    UWorld* World = Actor ? Actor->GetWorld() : nullptr;
+    if (UCombatantHandleSubsystem* Subsystem = World ? World->GetSubsystem<UCombatantHandleSubsystem>() : nullptr)
+    {
+        return Subsystem->Find(Actor);
+    }
+
+    // No world (e.g. CDOs): resolve without caching
+    static FCombatantHandles UnregisteredHandles;
+    check(IsInGameThread());
+    UnregisteredHandles.Resolve(Actor);
+    return UnregisteredHandles;
+}
+
+void UCombatantHandleSubsystem::OnActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+    Handles.Remove(Actor);
+}
@@ -1,25 +1,106 @@
 #include "Core/DamageCalculator.h"
+#include "Data/TrinityFlowTagData.h"
+#include "Math/VectorRegister.h"
+#include "Math/RandomStream.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<bool> CVarDamageResponseCache(
+    TEXT("TrinityFlow.Damage.ResponseCache"),
+    false,
+    TEXT("Resolve batched damage through the memoized per-signature response cache instead of the plain SIMD kernel"));
+
+namespace
+{
+    // GetSafeNormal() treats anything shorter than this (squared) as a zero vector
+    constexpr float ShieldDirectionTolerance = UE_SMALL_NUMBER;
+}
+
+void FDamageBatch::Reset(int32 ExpectedNum)
+{
+    Amounts.Reset(ExpectedNum);
+    Types.Reset(ExpectedNum);
+    Defences.Reset(ExpectedNum);
+    TagMasks.Reset(ExpectedNum);
+    DirectionX.Reset(ExpectedNum);
+    DirectionY.Reset(ExpectedNum);
+    DirectionZ.Reset(ExpectedNum);
+    ForwardX.Reset(ExpectedNum);
+    ForwardY.Reset(ExpectedNum);
+    ForwardZ.Reset(ExpectedNum);
+}
+
+int32 FDamageBatch::Add(const FDamageInfo& DamageInfo, float TargetDefence, ECharacterTag TargetTags, const FVector& DamageDirection, const FVector& TargetForward)
+{
+    const int32 Index = Amounts.Add(DamageInfo.Amount);
+    Types.Add(static_cast<uint8>(DamageInfo.Type));
+    Defences.Add(TargetDefence);
+    TagMasks.Add(static_cast<uint8>(TargetTags));
+    DirectionX.Add(DamageDirection.X);
+    DirectionY.Add(DamageDirection.Y);
+    DirectionZ.Add(DamageDirection.Z);
+    ForwardX.Add(TargetForward.X);
+    ForwardY.Add(TargetForward.Y);
+    ForwardZ.Add(TargetForward.Z);
+    return Index;
+}
+
+uint64 FDamageResponseCache::MakeKey(EDamageType Type, ECharacterTag Tags, float Defence)
+{
+    return (static_cast<uint64>(static_cast<uint8>(Type)) << 40) | (static_cast<uint64>(static_cast<uint8>(Tags)) << 32) | FMath::AsUInt(Defence);
+}
+
+FDamageResponse FDamageResponseCache::Find(EDamageType Type, ECharacterTag Tags, float Defence)
+{
+    const uint32 ActiveVersion = FCompiledTagTable::GetActiveVersion();
+    if (TagTableVersion != ActiveVersion)
+    {
+        Entries.Reset();
+        TagTableVersion = ActiveVersion;
+    }
+
+    const uint64 Key = MakeKey(Type, Tags, Defence);
+    if (const FDamageResponse* Found = Entries.Find(Key))
+    {
+        Hits++;
+        return *Found;
+    }
+
+    Misses++;
+    if (Entries.Num() >= MaxEntries)
+    {
+        Entries.Reset();
+    }
+
+    return Entries.Add(Key, FDamageCalculator::BuildResponse(Type, Tags, Defence));
+}
+
+void FDamageResponseCache::Reset()
+{
+    Entries.Reset();
+    ResetCounters();
+}
 
 float FDamageCalculator::CalculateDamage(const FDamageInfo& DamageInfo, const FCharacterResources& TargetResources, ECharacterTag TargetTags, const FVector& DamageDirection, const FVector& TargetForward)
 {
+    // Tag rules come from the compiled tag table (Ghost: no physical, Mechanical: no soul by default)
+    const FCompiledTagEffects& TagEffects = FCompiledTagTable::Get().GetEffects(TargetTags);
+    if (TagEffects.IsImmune(DamageInfo.Type))
+    {
+        return 0.0f;
+    }
+
+    // Check if shield blocks the damage (frontal attacks only by default)
+    if (IsShieldBlocking(TagEffects, DamageInfo.Type, DamageDirection, TargetForward))
+    {
+        return 0.0f;
+    }
+
     float FinalDamage = 0.0f;
     
     switch (DamageInfo.Type)
     {
         case EDamageType::Physical:
         {
-            // Ghost tag means no physical damage
-            if (EnumHasAnyFlags(TargetTags, ECharacterTag::Ghost))
-            {
-                return 0.0f;
-            }
-            
-            // Check if shield blocks the damage (frontal attacks only)
-            if (IsShieldBlocking(TargetTags, DamageDirection, TargetForward))
-            {
-                return 0.0f;
-            }
-            
             // Physical damage calculation: attackpoint * (100 - defencepoint)%
             // Clamp defense to max 95 to ensure at least 5% damage gets through
             float ClampedDefence = FMath::Min(TargetResources.DefencePoint, 95.0f);
@@ -30,29 +111,349 @@ float FDamageCalculator::CalculateDamage(const FDamageInfo& DamageInfo, const FC
         
         case EDamageType::Soul:
         {
-            // Mechanical tag means no soul damage
-            if (EnumHasAnyFlags(TargetTags, ECharacterTag::Mechanical))
-            {
-                return 0.0f;
-            }
-            
             // Soul damage calculation: attackpoint * 2 (bypasses defenses)
             FinalDamage = DamageInfo.Amount * 2.0f;
             break;
         }
     }
     
-    return FinalDamage;
+    // Tag reductions and modifiers (Armored, HaveSoul...) when defined in the tag table
+    return FinalDamage * TagEffects.GetMultiplier(DamageInfo.Type);
 }
 
-bool FDamageCalculator::IsShieldBlocking(ECharacterTag Tags, const FVector& DamageDirection, const FVector& TargetForward)
+bool FDamageCalculator::IsShieldBlocking(const FCompiledTagEffects& TagEffects, EDamageType Type, const FVector& DamageDirection, const FVector& TargetForward)
 {
-    if (!EnumHasAnyFlags(Tags, ECharacterTag::Shielded))
+    const uint8 TypeBit = 1 << static_cast<uint8>(Type);
+    const bool bBlocksFront = (TagEffects.FrontBlockMask & TypeBit) != 0;
+    const bool bBlocksBack = (TagEffects.BackBlockMask & TypeBit) != 0;
+    if (!bBlocksFront && !bBlocksBack)
     {
         return false;
     }
     
-    // Shield blocks if damage comes from front (dot product > 0 means frontal)
+    // Dot product > 0 means frontal, < 0 means from behind
     float DotProduct = FVector::DotProduct(-DamageDirection.GetSafeNormal(), TargetForward.GetSafeNormal());
-    return DotProduct > 0.0f;
-}
\ No newline at end of file
+    return (bBlocksFront && DotProduct > 0.0f) || (bBlocksBack && DotProduct < 0.0f);
+}
+
+FDamageResponse FDamageCalculator::BuildResponse(EDamageType Type, ECharacterTag TargetTags, float TargetDefence)
+{
+    const FCompiledTagEffects& TagEffects = FCompiledTagTable::Get().GetEffects(TargetTags);
+    const uint8 TypeBit = 1 << static_cast<uint8>(Type);
+
+    FDamageResponse Response;
+    Response.bImmune = TagEffects.IsImmune(Type);
+    Response.bBlocksFront = (TagEffects.FrontBlockMask & TypeBit) != 0;
+    Response.bBlocksBack = (TagEffects.BackBlockMask & TypeBit) != 0;
+    Response.TagMultiplier = TagEffects.GetMultiplier(Type);
+
+    // Same arithmetic as CalculateDamage so cached results match the scalar path exactly
+    switch (Type)
+    {
+        case EDamageType::Physical:
+            Response.BaseMultiplier = (100.0f - FMath::Min(TargetDefence, 95.0f)) / 100.0f;
+            break;
+
+        case EDamageType::Soul:
+            Response.BaseMultiplier = 2.0f;
+            break;
+    }
+
+    return Response;
+}
+
+float FDamageCalculator::ApplyResponse(const FDamageResponse& Response, float Amount, const FVector& DamageDirection, const FVector& TargetForward)
+{
+    if (Response.bImmune)
+    {
+        return 0.0f;
+    }
+
+    if (Response.bBlocksFront || Response.bBlocksBack)
+    {
+        float DotProduct = FVector::DotProduct(-DamageDirection.GetSafeNormal(), TargetForward.GetSafeNormal());
+        if ((Response.bBlocksFront && DotProduct > 0.0f) || (Response.bBlocksBack && DotProduct < 0.0f))
+        {
+            return 0.0f;
+        }
+    }
+
+    return Amount * Response.BaseMultiplier * Response.TagMultiplier;
+}
+
+float FDamageCalculator::CalculateDamageLane(const FDamageBatch& Batch, int32 Index)
+{
+    FDamageInfo DamageInfo(Batch.Amounts[Index], static_cast<EDamageType>(Batch.Types[Index]));
+    FCharacterResources Resources;
+    Resources.DefencePoint = Batch.Defences[Index];
+
+    const FVector DamageDirection(Batch.DirectionX[Index], Batch.DirectionY[Index], Batch.DirectionZ[Index]);
+    const FVector TargetForward(Batch.ForwardX[Index], Batch.ForwardY[Index], Batch.ForwardZ[Index]);
+
+    return CalculateDamage(DamageInfo, Resources, static_cast<ECharacterTag>(Batch.TagMasks[Index]), DamageDirection, TargetForward);
+}
+
+void FDamageCalculator::CalculateDamageBatch(const FDamageBatch& Batch, TArrayView<float> OutDamage, FDamageResponseCache* ResponseCache)
+{
+    if (ResponseCache)
+    {
+        CalculateDamageBatchCached(Batch, OutDamage, *ResponseCache);
+        return;
+    }
+
+    const int32 Num = Batch.Num();
+    check(OutDamage.Num() >= Num);
+
+    const VectorRegister4Float Zero = VectorZeroFloat();
+    const VectorRegister4Float Hundred = VectorSetFloat1(100.0f);
+    const VectorRegister4Float MaxDefence = VectorSetFloat1(95.0f);
+    const VectorRegister4Float SoulMultiplier = VectorSetFloat1(2.0f);
+    const VectorRegister4Float Tolerance = VectorSetFloat1(ShieldDirectionTolerance);
+
+    const VectorRegister4Int SoulType = VectorIntSet1(static_cast<int32>(EDamageType::Soul));
+
+    const FCompiledTagTable& TagTable = FCompiledTagTable::Get();
+    const uint8* Types = Batch.Types.GetData();
+    const uint8* Tags = Batch.TagMasks.GetData();
+
+    int32 Index = 0;
+    for (; Index + 4 <= Num; Index += 4)
+    {
+        const VectorRegister4Float Amount = VectorLoad(&Batch.Amounts[Index]);
+        const VectorRegister4Float Defence = VectorLoad(&Batch.Defences[Index]);
+
+        const VectorRegister4Int Type = MakeVectorRegisterInt(Types[Index], Types[Index + 1], Types[Index + 2], Types[Index + 3]);
+
+        // Gather each lane's tag effects for its damage type from the compiled table
+        int32 Immune[4];
+        int32 FrontBlock[4];
+        int32 BackBlock[4];
+        float Multiplier[4];
+        for (int32 Lane = 0; Lane < 4; Lane++)
+        {
+            const FCompiledTagEffects& TagEffects = TagTable.GetEffects(static_cast<ECharacterTag>(Tags[Index + Lane]));
+            const uint8 TypeBit = 1 << Types[Index + Lane];
+            Immune[Lane] = (TagEffects.ImmunityMask & TypeBit) ? -1 : 0;
+            FrontBlock[Lane] = (TagEffects.FrontBlockMask & TypeBit) ? -1 : 0;
+            BackBlock[Lane] = (TagEffects.BackBlockMask & TypeBit) ? -1 : 0;
+            Multiplier[Lane] = TagEffects.DamageMultipliers[Types[Index + Lane]];
+        }
+
+        // Lane masks (all bits set = true)
+        const VectorRegister4Float IsSoul = VectorCastIntToFloat(VectorIntCompareEQ(Type, SoulType));
+        const VectorRegister4Float IsImmune = VectorCastIntToFloat(MakeVectorRegisterInt(Immune[0], Immune[1], Immune[2], Immune[3]));
+        const VectorRegister4Float BlocksFront = VectorCastIntToFloat(MakeVectorRegisterInt(FrontBlock[0], FrontBlock[1], FrontBlock[2], FrontBlock[3]));
+        const VectorRegister4Float BlocksBack = VectorCastIntToFloat(MakeVectorRegisterInt(BackBlock[0], BackBlock[1], BackBlock[2], BackBlock[3]));
+
+        // Frontal hits: dot(-Direction, Forward) > 0, ignoring degenerate vectors like GetSafeNormal() does
+        const VectorRegister4Float DirX = VectorLoad(&Batch.DirectionX[Index]);
+        const VectorRegister4Float DirY = VectorLoad(&Batch.DirectionY[Index]);
+        const VectorRegister4Float DirZ = VectorLoad(&Batch.DirectionZ[Index]);
+        const VectorRegister4Float FwdX = VectorLoad(&Batch.ForwardX[Index]);
+        const VectorRegister4Float FwdY = VectorLoad(&Batch.ForwardY[Index]);
+        const VectorRegister4Float FwdZ = VectorLoad(&Batch.ForwardZ[Index]);
+
+        const VectorRegister4Float Dot = VectorMultiplyAdd(DirZ, FwdZ, VectorMultiplyAdd(DirY, FwdY, VectorMultiply(DirX, FwdX)));
+        const VectorRegister4Float DirLengthSq = VectorMultiplyAdd(DirZ, DirZ, VectorMultiplyAdd(DirY, DirY, VectorMultiply(DirX, DirX)));
+        const VectorRegister4Float FwdLengthSq = VectorMultiplyAdd(FwdZ, FwdZ, VectorMultiplyAdd(FwdY, FwdY, VectorMultiply(FwdX, FwdX)));
+
+        const VectorRegister4Float HasDirection = VectorBitwiseAnd(VectorCompareGE(DirLengthSq, Tolerance), VectorCompareGE(FwdLengthSq, Tolerance));
+        const VectorRegister4Float IsFrontal = VectorBitwiseAnd(VectorCompareLT(Dot, Zero), HasDirection);
+        const VectorRegister4Float IsBehind = VectorBitwiseAnd(VectorCompareGT(Dot, Zero), HasDirection);
+        const VectorRegister4Float IsBlocked = VectorBitwiseOr(VectorBitwiseAnd(BlocksFront, IsFrontal), VectorBitwiseAnd(BlocksBack, IsBehind));
+
+        // Physical: Amount * ((100 - min(Defence, 95)) / 100), same operation order as the scalar path
+        const VectorRegister4Float PhysicalDamage = VectorMultiply(Amount, VectorDivide(VectorSubtract(Hundred, VectorMin(Defence, MaxDefence)), Hundred));
+
+        // Soul: Amount * 2, bypasses defence
+        const VectorRegister4Float SoulDamage = VectorMultiply(Amount, SoulMultiplier);
+
+        const VectorRegister4Float Damage = VectorMultiply(VectorSelect(IsSoul, SoulDamage, PhysicalDamage), VectorLoad(Multiplier));
+        VectorStore(VectorSelect(VectorBitwiseOr(IsImmune, IsBlocked), Zero, Damage), &OutDamage[Index]);
+    }
+
+    // Remaining hits go through the scalar path
+    for (; Index < Num; Index++)
+    {
+        OutDamage[Index] = CalculateDamageLane(Batch, Index);
+    }
+}
+
+bool FDamageCalculator::IsResponseCacheEnabled()
+{
+    return CVarDamageResponseCache.GetValueOnGameThread();
+}
+
+void FDamageCalculator::CalculateDamageBatchCached(const FDamageBatch& Batch, TArrayView<float> OutDamage, FDamageResponseCache& ResponseCache)
+{
+    const int32 Num = Batch.Num();
+    check(OutDamage.Num() >= Num);
+
+    const VectorRegister4Float Zero = VectorZeroFloat();
+    const VectorRegister4Float Tolerance = VectorSetFloat1(ShieldDirectionTolerance);
+
+    int32 Index = 0;
+    for (; Index + 4 <= Num; Index += 4)
+    {
+        // One cache lookup per lane replaces the defence clamp and tag table gather
+        int32 Immune[4];
+        int32 FrontBlock[4];
+        int32 BackBlock[4];
+        float BaseMultiplier[4];
+        float TagMultiplier[4];
+        for (int32 Lane = 0; Lane < 4; Lane++)
+        {
+            const int32 HitIndex = Index + Lane;
+            const FDamageResponse Response = ResponseCache.Find(static_cast<EDamageType>(Batch.Types[HitIndex]),
+                static_cast<ECharacterTag>(Batch.TagMasks[HitIndex]), Batch.Defences[HitIndex]);
+
+            Immune[Lane] = Response.bImmune ? -1 : 0;
+            FrontBlock[Lane] = Response.bBlocksFront ? -1 : 0;
+            BackBlock[Lane] = Response.bBlocksBack ? -1 : 0;
+            BaseMultiplier[Lane] = Response.BaseMultiplier;
+            TagMultiplier[Lane] = Response.TagMultiplier;
+        }
+
+        const VectorRegister4Float IsImmune = VectorCastIntToFloat(MakeVectorRegisterInt(Immune[0], Immune[1], Immune[2], Immune[3]));
+        const VectorRegister4Float BlocksFront = VectorCastIntToFloat(MakeVectorRegisterInt(FrontBlock[0], FrontBlock[1], FrontBlock[2], FrontBlock[3]));
+        const VectorRegister4Float BlocksBack = VectorCastIntToFloat(MakeVectorRegisterInt(BackBlock[0], BackBlock[1], BackBlock[2], BackBlock[3]));
+
+        const VectorRegister4Float DirX = VectorLoad(&Batch.DirectionX[Index]);
+        const VectorRegister4Float DirY = VectorLoad(&Batch.DirectionY[Index]);
+        const VectorRegister4Float DirZ = VectorLoad(&Batch.DirectionZ[Index]);
+        const VectorRegister4Float FwdX = VectorLoad(&Batch.ForwardX[Index]);
+        const VectorRegister4Float FwdY = VectorLoad(&Batch.ForwardY[Index]);
+        const VectorRegister4Float FwdZ = VectorLoad(&Batch.ForwardZ[Index]);
+
+        const VectorRegister4Float Dot = VectorMultiplyAdd(DirZ, FwdZ, VectorMultiplyAdd(DirY, FwdY, VectorMultiply(DirX, FwdX)));
+        const VectorRegister4Float DirLengthSq = VectorMultiplyAdd(DirZ, DirZ, VectorMultiplyAdd(DirY, DirY, VectorMultiply(DirX, DirX)));
+        const VectorRegister4Float FwdLengthSq = VectorMultiplyAdd(FwdZ, FwdZ, VectorMultiplyAdd(FwdY, FwdY, VectorMultiply(FwdX, FwdX)));
+
+        const VectorRegister4Float HasDirection = VectorBitwiseAnd(VectorCompareGE(DirLengthSq, Tolerance), VectorCompareGE(FwdLengthSq, Tolerance));
+        const VectorRegister4Float IsFrontal = VectorBitwiseAnd(VectorCompareLT(Dot, Zero), HasDirection);
+        const VectorRegister4Float IsBehind = VectorBitwiseAnd(VectorCompareGT(Dot, Zero), HasDirection);
+        const VectorRegister4Float IsBlocked = VectorBitwiseOr(VectorBitwiseAnd(BlocksFront, IsFrontal), VectorBitwiseAnd(BlocksBack, IsBehind));
+
+        const VectorRegister4Float Damage = VectorMultiply(VectorMultiply(VectorLoad(&Batch.Amounts[Index]), VectorLoad(BaseMultiplier)), VectorLoad(TagMultiplier));
+        VectorStore(VectorSelect(VectorBitwiseOr(IsImmune, IsBlocked), Zero, Damage), &OutDamage[Index]);
+    }
+
+    for (; Index < Num; Index++)
+    {
+        const FDamageResponse Response = ResponseCache.Find(static_cast<EDamageType>(Batch.Types[Index]),
+            static_cast<ECharacterTag>(Batch.TagMasks[Index]), Batch.Defences[Index]);
+
+        OutDamage[Index] = ApplyResponse(Response,
+            Batch.Amounts[Index],
+            FVector(Batch.DirectionX[Index], Batch.DirectionY[Index], Batch.DirectionZ[Index]),
+            FVector(Batch.ForwardX[Index], Batch.ForwardY[Index], Batch.ForwardZ[Index]));
+    }
+}
+
+#if !UE_BUILD_SHIPPING
+int32 FDamageCalculator::VerifyBatchParity(int32 NumSamples, int32 Seed)
+{
+    FRandomStream Random(Seed);
+    FDamageBatch Batch;
+    Batch.Reset(NumSamples);
+
+    for (int32 i = 0; i < NumSamples; i++)
+    {
+        FDamageInfo DamageInfo(Random.FRandRange(0.0f, 200.0f), Random.RandBool() ? EDamageType::Soul : EDamageType::Physical);
+        float Defence = Random.FRandRange(0.0f, 120.0f);
+        ECharacterTag Tags = static_cast<ECharacterTag>(Random.RandRange(0, 255));
+
+        // Include degenerate directions to exercise the GetSafeNormal() tolerance
+        FVector Direction = (i % 17 == 0) ? FVector::ZeroVector : Random.GetUnitVector() * Random.FRandRange(0.5f, 500.0f);
+        FVector Forward = Random.GetUnitVector();
+
+        Batch.Add(DamageInfo, Defence, Tags, Direction, Forward);
+    }
+
+    TArray<float> BatchResults;
+    BatchResults.SetNumUninitialized(NumSamples);
+    CalculateDamageBatch(Batch, BatchResults);
+
+    // The cached path must agree as well
+    FDamageResponseCache ResponseCache;
+    TArray<float> CachedResults;
+    CachedResults.SetNumUninitialized(NumSamples);
+    CalculateDamageBatch(Batch, CachedResults, &ResponseCache);
+
+    int32 Mismatches = 0;
+    for (int32 i = 0; i < NumSamples; i++)
+    {
+        const float Expected = CalculateDamageLane(Batch, i);
+        if (!FMath::IsNearlyEqual(Expected, BatchResults[i], KINDA_SMALL_NUMBER) || !FMath::IsNearlyEqual(Expected, CachedResults[i], KINDA_SMALL_NUMBER))
+        {
+            if (Mismatches < 10)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Damage batch mismatch at %d: scalar=%.4f batch=%.4f cached=%.4f"), i, Expected, BatchResults[i], CachedResults[i]);
+            }
+            Mismatches++;
+        }
+    }
+
+    return Mismatches;
+}
+
+static FAutoConsoleCommand VerifyDamageBatchCommand(
+    TEXT("TrinityFlow.Damage.VerifyBatch"),
+    TEXT("Compares FDamageCalculator::CalculateDamageBatch against the scalar path. Args: [NumSamples] [Seed]"),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+    {
+        const int32 NumSamples = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 4099;
+        const int32 Seed = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 1337;
+
+        const int32 Mismatches = FDamageCalculator::VerifyBatchParity(FMath::Max(1, NumSamples), Seed);
+        UE_LOG(LogTemp, Log, TEXT("Damage batch parity: %d samples, %d mismatches"), NumSamples, Mismatches);
+    }));
+
+static FAutoConsoleCommand BenchmarkDamageBatchCommand(
+    TEXT("TrinityFlow.Damage.BenchmarkBatch"),
+    TEXT("Times the plain and cached batch kernels on the same hits. Args: [NumHits] [Iterations] [NumSignatures]"),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+    {
+        const int32 NumHits = FMath::Max(1, Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 256);
+        const int32 Iterations = FMath::Max(1, Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 1000);
+        const int32 NumSignatures = FMath::Max(1, Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 8);
+
+        // A fight has a handful of archetypes, so hits repeat a few (tags, defence) signatures
+        FRandomStream Random(1337);
+        TArray<TPair<ECharacterTag, float>> Signatures;
+        for (int32 i = 0; i < NumSignatures; i++)
+        {
+            Signatures.Emplace(static_cast<ECharacterTag>(Random.RandRange(0, 255)), Random.FRandRange(0.0f, 60.0f));
+        }
+
+        FDamageBatch Batch;
+        Batch.Reset(NumHits);
+        for (int32 i = 0; i < NumHits; i++)
+        {
+            const TPair<ECharacterTag, float>& Signature = Signatures[Random.RandHelper(NumSignatures)];
+            Batch.Add(FDamageInfo(Random.FRandRange(10.0f, 50.0f), Random.RandBool() ? EDamageType::Soul : EDamageType::Physical),
+                Signature.Value, Signature.Key, Random.GetUnitVector(), Random.GetUnitVector());
+        }
+
+        TArray<float> Results;
+        Results.SetNumUninitialized(NumHits);
+        FDamageResponseCache ResponseCache;
+
+        double StartTime = FPlatformTime::Seconds();
+        for (int32 i = 0; i < Iterations; i++)
+        {
+            FDamageCalculator::CalculateDamageBatch(Batch, Results);
+        }
+        const double PlainMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / Iterations;
+
+        StartTime = FPlatformTime::Seconds();
+        for (int32 i = 0; i < Iterations; i++)
+        {
+            FDamageCalculator::CalculateDamageBatch(Batch, Results, &ResponseCache);
+        }
+        const double CachedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / Iterations;
+
+        UE_LOG(LogTemp, Log, TEXT("Damage batch benchmark: %d hits, %d signatures: plain %.4f ms, cached %.4f ms per batch"),
+            NumHits, NumSignatures, PlainMs, CachedMs);
+    }));
+#endif
\ No newline at end of file
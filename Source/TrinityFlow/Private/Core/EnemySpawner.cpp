@@ -4,10 +4,10 @@
 #include "Enemy/ShieldedTankEnemy.h"
 #include "Enemy/PhaseEnemy.h"
 #include "Enemy/ShieldedTankRobotEnemy.h"
+#include "AI/EnemyHordeSubsystem.h"
+#include "Core/CombatReplaySubsystem.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
-#include "UI/TrinityFlowUIManager.h"
-#include "Core/HealthComponent.h"
 #include "Kismet/GameplayStatics.h"
 
 AEnemySpawner::AEnemySpawner()
@@ -29,28 +29,46 @@ void AEnemySpawner::BeginPlay()
 void AEnemySpawner::SpawnEnemy()
 {
     TSubclassOf<AEnemyBase> EnemyClass = GetEnemyClassForType(EnemyTypeToSpawn);
+
+    if (UCombatReplaySubsystem* Replay = UCombatReplaySubsystem::Get(this))
+    {
+        Replay->RecordSpawn(static_cast<uint8>(EnemyTypeToSpawn), bSpawnAsHorde ? HordeCount : 1, GetActorLocation());
+    }
     
-    if (EnemyClass)
+    if (EnemyClass && bSpawnAsHorde)
+    {
+        SpawnHorde(EnemyClass);
+    }
+    else if (EnemyClass)
     {
         FActorSpawnParameters SpawnParams;
         SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
         
-        AEnemyBase* SpawnedEnemy = GetWorld()->SpawnActor<AEnemyBase>(EnemyClass, GetActorLocation(), GetActorRotation(), SpawnParams);
-        
-        // Register damage events with UI Manager for damage numbers
-        if (SpawnedEnemy)
-        {
-            if (UGameInstance* GameInstance = GetGameInstance())
-            {
-                if (UTrinityFlowUIManager* UIManager = GameInstance->GetSubsystem<UTrinityFlowUIManager>())
-                {
-                    if (UHealthComponent* HealthComp = SpawnedEnemy->FindComponentByClass<UHealthComponent>())
-                    {
-                        HealthComp->OnDamageDealt.AddDynamic(UIManager, &UTrinityFlowUIManager::OnDamageDealt);
-                    }
-                }
-            }
-        }
+        // Damage numbers come from the combat event bus; no per-enemy binding needed
+        GetWorld()->SpawnActor<AEnemyBase>(EnemyClass, GetActorLocation(), GetActorRotation(), SpawnParams);
+    }
+}
+
+void AEnemySpawner::SpawnHorde(TSubclassOf<AEnemyBase> EnemyClass)
+{
+    UEnemyHordeSubsystem* Horde = GetWorld()->GetSubsystem<UEnemyHordeSubsystem>();
+    if (!Horde)
+    {
+        return;
+    }
+
+    if (HordeMesh)
+    {
+        Horde->SetRepresentationMesh(HordeMesh);
+    }
+
+    // Offsets come from the replay stream so recorded encounters spawn the same layout
+    FRandomStream& Random = UCombatReplaySubsystem::GetRandomStream(this);
+    for (int32 Index = 0; Index < HordeCount; Index++)
+    {
+        const float Angle = Random.FRandRange(0.0f, 2.0f * PI);
+        const FVector2D Offset = FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * HordeSpawnRadius * FMath::Sqrt(Random.FRand());
+        Horde->SpawnEntity(EnemyClass, GetActorLocation() + FVector(Offset, 0.0f), GetActorRotation());
     }
 }
 
@@ -1,9 +1,15 @@
 #include "Core/HealthComponent.h"
 #include "Core/DamageCalculator.h"
+#include "Core/CombatResolutionSubsystem.h"
+#include "Core/CombatantHandleSubsystem.h"
+#include "Core/CombatAttributeSubsystem.h"
+#include "Core/CombatSpatialGridSubsystem.h"
 #include "Core/TagComponent.h"
+#include "Core/CombatEventRecorder.h"
 #include "Core/AnimationComponent.h"
 #include "Enemy/EnemyAnimationComponent.h"
 #include "GameFramework/Actor.h"
+#include "Engine/World.h"
 
 UHealthComponent::UHealthComponent()
 {
@@ -17,6 +23,12 @@ void UHealthComponent::BeginPlay()
     if (AActor* Owner = GetOwner())
     {
         TagComponent = Owner->FindComponentByClass<UTagComponent>();
+
+        // Anything that can take damage is visible to proximity queries, not only enemies and the player
+        if (UCombatSpatialGridSubsystem* SpatialGrid = GetWorld()->GetSubsystem<UCombatSpatialGridSubsystem>())
+        {
+            SpatialGrid->Register(Owner);
+        }
     }
     else
     {
@@ -31,48 +43,142 @@ void UHealthComponent::TakeDamage(const FDamageInfo& DamageInfo, const FVector&
         return;
     }
     
+    if (UWorld* World = GetWorld())
+    {
+        if (UCombatResolutionSubsystem* Resolution = World->GetSubsystem<UCombatResolutionSubsystem>())
+        {
+            Resolution->SubmitDamage(this, DamageInfo, DamageDirection);
+            return;
+        }
+    }
+    
+    // No resolution subsystem (e.g. preview worlds) - resolve immediately
+    const float ActualDamageDealt = ApplyDamage(DamageInfo, DamageDirection);
+    if (ActualDamageDealt > 0.0f)
+    {
+        FResolvedDamageEvent Event;
+        Event.Instigator = DamageInfo.Instigator;
+        Event.Type = DamageInfo.Type;
+        Event.ActualDamage = ActualDamageDealt;
+        Event.bIsLeftWeapon = DamageInfo.bIsLeftWeapon;
+        
+        BroadcastResolvedDamage({ Event });
+    }
+}
+
+float UHealthComponent::ApplyDamage(const FDamageInfo& DamageInfo, const FVector& DamageDirection)
+{
+    if (!IsAlive())
+    {
+        return 0.0f;
+    }
+    
     AActor* Owner = GetOwner();
     if (!Owner)
     {
         UE_LOG(LogTemp, Error, TEXT("HealthComponent: No owner found when taking damage"));
-        return;
+        return 0.0f;
     }
     
-    ECharacterTag Tags = TagComponent ? TagComponent->GetTags() : ECharacterTag::None;
     FVector OwnerForward = Owner->GetActorForwardVector();
     
-    float FinalDamage = FDamageCalculator::CalculateDamage(DamageInfo, Resources, Tags, DamageDirection, OwnerForward);
+    float FinalDamage = FDamageCalculator::CalculateDamage(DamageInfo, Resources, GetDamageTags(), DamageDirection, OwnerForward);
+    return ApplyFinalDamage(FinalDamage);
+}
+
+float UHealthComponent::ApplyFinalDamage(float FinalDamage)
+{
+    if (FinalDamage <= 0.0f || !IsAlive())
+    {
+        return 0.0f;
+    }
     
-    if (FinalDamage > 0.0f)
+    float HealthBefore = Resources.Health;
+    Resources.Health = FMath::Max(0.0f, Resources.Health - FinalDamage);
+    return HealthBefore - Resources.Health;
+}
+
+ECharacterTag UHealthComponent::GetDamageTags() const
+{
+    return TagComponent ? TagComponent->GetTags() : ECharacterTag::None;
+}
+
+void UHealthComponent::BroadcastResolvedDamage(const TArray<FResolvedDamageEvent>& Events)
+{
+    AActor* Owner = GetOwner();
+    if (!Owner || Events.Num() == 0)
     {
-        float HealthBefore = Resources.Health;
-        Resources.Health = FMath::Max(0.0f, Resources.Health - FinalDamage);
-        float ActualDamageDealt = HealthBefore - Resources.Health;
-        
-        OnHealthChanged.Broadcast(Resources.Health);
-        OnDamageDealt.Broadcast(GetOwner(), ActualDamageDealt, DamageInfo.Instigator, DamageInfo.Type);
+        return;
+    }
+    
+    OnHealthChanged.Broadcast(Resources.Health);
+    OnResourcesChangedNative.Broadcast(this);
+    
+    FCombatEventBus* EventBus = UCombatResolutionSubsystem::GetEventBus(this);
+    
+    for (const FResolvedDamageEvent& Event : Events)
+    {
+        OnDamageDealt.Broadcast(Owner, Event.ActualDamage, Event.Instigator, Event.Type);
         
-        // Play hit response animation
-        // Check for player animation component
-        if (UAnimationComponent* AnimComp = Owner->FindComponentByClass<UAnimationComponent>())
+        if (EventBus)
         {
-            AnimComp->PlayHitResponse();
-        }
-        // Check for enemy animation component
-        else if (UEnemyAnimationComponent* EnemyAnimComp = Owner->FindComponentByClass<UEnemyAnimationComponent>())
-        {
-            EnemyAnimComp->PlayHitResponse(DamageInfo.Type, DamageInfo.bIsLeftWeapon);
+            FCombatEvent BusEvent;
+            BusEvent.Type = ECombatEventType::DamageDealt;
+            BusEvent.Target = Owner;
+            BusEvent.Instigator = Event.Instigator;
+            BusEvent.Location = Owner->GetActorLocation();
+            BusEvent.Amount = Event.ActualDamage;
+            BusEvent.DamageType = Event.Type;
+            BusEvent.bIsLeftWeapon = Event.bIsLeftWeapon;
+            EventBus->Publish(BusEvent);
         }
+    }
+    
+    // Play one hit response per resolution pass, using the most recent hit
+    const FResolvedDamageEvent& LastEvent = Events.Last();
+    
+    const FCombatantHandles& Handles = UCombatantHandleSubsystem::Get(Owner);
+    
+    // Check for player animation component
+    if (UAnimationComponent* AnimComp = Handles.Animation.Get())
+    {
+        AnimComp->PlayHitResponse();
+    }
+    // Check for enemy animation component
+    else if (UEnemyAnimationComponent* EnemyAnimComp = Handles.EnemyAnimation.Get())
+    {
+        EnemyAnimComp->PlayHitResponse(LastEvent.Type, LastEvent.bIsLeftWeapon);
+    }
+    
+    if (!IsAlive())
+    {
+        TRINITYFLOW_RECORD_COMBAT(Death, LastEvent.Instigator, Owner);
+        OnDeath.Broadcast();
         
-        if (!IsAlive())
+        if (EventBus)
         {
-            OnDeath.Broadcast();
+            FCombatEvent BusEvent;
+            BusEvent.Type = ECombatEventType::Death;
+            BusEvent.Target = Owner;
+            BusEvent.Instigator = LastEvent.Instigator;
+            BusEvent.Location = Owner->GetActorLocation();
+            BusEvent.DamageType = LastEvent.Type;
+            EventBus->Publish(BusEvent);
         }
     }
 }
 
 void UHealthComponent::SetResources(const FCharacterResources& NewResources)
 {
+    const bool bAttributesChanged = NewResources.AttackPoint != Resources.AttackPoint || NewResources.DefencePoint != Resources.DefencePoint;
+
     Resources = NewResources;
+
+    if (bAttributesChanged)
+    {
+        UCombatAttributeSubsystem::NotifySourceChanged(this);
+    }
+
     OnHealthChanged.Broadcast(Resources.Health);
+    OnResourcesChangedNative.Broadcast(this);
 }
\ No newline at end of file
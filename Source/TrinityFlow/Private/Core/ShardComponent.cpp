@@ -1,4 +1,5 @@
 #include "Core/ShardComponent.h"
+#include "Core/CombatAttributeSubsystem.h"
 #include "GameFramework/Actor.h"
 #include "Engine/World.h"
 
@@ -59,6 +60,8 @@ bool UShardComponent::ActivateShards(EShardType Type, int32 Count)
                 Data->InactiveCount,
                 Data->ActiveCount);
             
+            UCombatAttributeSubsystem::NotifySourceChanged(this);
+
             OnShardsActivated.Broadcast(Type, Count, Data->ActiveCount);
             
             // Broadcast damage bonus change
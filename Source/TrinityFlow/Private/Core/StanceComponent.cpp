@@ -1,4 +1,5 @@
 #include "Core/StanceComponent.h"
+#include "Core/CombatAttributeSubsystem.h"
 #include "Engine/World.h"
 
 UStanceComponent::UStanceComponent()
@@ -205,6 +206,9 @@ float UStanceComponent::GetDamageModifier(EDamageType DamageType) const
 
 void UStanceComponent::BroadcastStanceChange(EStanceType NewStance)
 {
+    // Stance modifiers are part of the owner's cached outgoing damage
+    UCombatAttributeSubsystem::NotifySourceChanged(this);
+
     OnStanceChanged.Broadcast(NewStance);
     
     // Log for testing
@@ -1,35 +1,9 @@
 #include "Core/StateComponent.h"
+#include "Core/StatusEffectSubsystem.h"
 
 UStateComponent::UStateComponent()
 {
-    PrimaryComponentTick.bCanEverTick = true;
-}
-
-void UStateComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-    // Update marked timer
-    if (MarkedTimer > 0.0f)
-    {
-        MarkedTimer -= DeltaTime;
-        if (MarkedTimer <= 0.0f)
-        {
-            RemoveState(ECharacterState::Marked);
-            MarkedTimer = 0.0f;
-        }
-    }
-
-    // Update vulnerable timer
-    if (VulnerableTimer > 0.0f)
-    {
-        VulnerableTimer -= DeltaTime;
-        if (VulnerableTimer <= 0.0f)
-        {
-            RemoveState(ECharacterState::Vulnerable);
-            VulnerableTimer = 0.0f;
-        }
-    }
+    PrimaryComponentTick.bCanEverTick = false;
 }
 
 void UStateComponent::AddState(ECharacterState State)
@@ -61,12 +35,31 @@ bool UStateComponent::HasState(ECharacterState State) const
 
 void UStateComponent::SetMarked(float Duration)
 {
-    AddState(ECharacterState::Marked);
-    MarkedTimer = Duration;
+    // Timed states live in the status effect subsystem, which sets and clears the flag
+    if (UStatusEffectSubsystem* Effects = UStatusEffectSubsystem::Get(this))
+    {
+        Effects->ApplyEffect(GetOwner(), EStatusEffect::Marked, Duration);
+    }
+    else
+    {
+        AddState(ECharacterState::Marked);
+    }
 }
 
 void UStateComponent::SetVulnerable(float Duration)
 {
-    AddState(ECharacterState::Vulnerable);
-    VulnerableTimer = Duration;
+    if (UStatusEffectSubsystem* Effects = UStatusEffectSubsystem::Get(this))
+    {
+        Effects->ApplyEffect(GetOwner(), EStatusEffect::Vulnerable, Duration);
+    }
+    else
+    {
+        AddState(ECharacterState::Vulnerable);
+    }
+}
+
+float UStateComponent::GetMarkedTimeRemaining() const
+{
+    const UStatusEffectSubsystem* Effects = UStatusEffectSubsystem::Get(this);
+    return Effects ? Effects->GetTimeRemaining(GetOwner(), EStatusEffect::Marked) : 0.0f;
 }
\ No newline at end of file
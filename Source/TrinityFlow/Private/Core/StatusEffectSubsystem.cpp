@@ -0,0 +1,348 @@
+#include "Core/StatusEffectSubsystem.h"
+#include "Core/CombatantHandleSubsystem.h"
+#include "Core/HealthComponent.h"
+#include "Core/StateComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+    const FStatusEffectDefinition StatusEffectDefinitions[] =
+    {
+        { 1, ECharacterState::Marked },     // Marked
+        { 1, ECharacterState::Vulnerable }, // Vulnerable
+        { 5, ECharacterState::None },       // DamageOverTime
+        { 3, ECharacterState::None }        // Slow
+    };
+    static_assert(UE_ARRAY_COUNT(StatusEffectDefinitions) == static_cast<int32>(EStatusEffect::Count), "One definition per status effect");
+}
+
+void UStatusEffectSubsystem::Deinitialize()
+{
+    OwnerKeys.Empty();
+    Owners.Empty();
+    EffectIds.Empty();
+    Stacks.Empty();
+    ExpiryTimes.Empty();
+    Magnitudes.Empty();
+    ExpiryHandles.Empty();
+    DamageHandles.Empty();
+    Instigators.Empty();
+    DamageTypes.Empty();
+    ActorEffects.Empty();
+    AppliedSlowScales.Empty();
+
+    Super::Deinitialize();
+}
+
+UStatusEffectSubsystem* UStatusEffectSubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UStatusEffectSubsystem>() : nullptr;
+}
+
+const FStatusEffectDefinition& UStatusEffectSubsystem::GetDefinition(EStatusEffect Effect)
+{
+    return StatusEffectDefinitions[static_cast<int32>(Effect)];
+}
+
+int32 UStatusEffectSubsystem::FindRow(const AActor* Target, EStatusEffect Effect) const
+{
+    if (const TArray<int32, TInlineAllocator<4>>* Rows = Target ? ActorEffects.Find(Target) : nullptr)
+    {
+        for (const int32 Row : *Rows)
+        {
+            if (EffectIds[Row] == Effect)
+            {
+                return Row;
+            }
+        }
+    }
+
+    return INDEX_NONE;
+}
+
+void UStatusEffectSubsystem::ApplyEffect(AActor* Target, EStatusEffect Effect, float Duration, float Magnitude, AActor* Instigator, EDamageType DamageType)
+{
+    if (!Target || Duration <= 0.0f)
+    {
+        return;
+    }
+
+    UCombatTimerSubsystem* Timers = UCombatTimerSubsystem::Get(this);
+    if (!Timers)
+    {
+        return;
+    }
+
+    const FStatusEffectDefinition& Definition = GetDefinition(Effect);
+    const double Now = GetWorld()->GetTimeSeconds();
+    const double Expiry = Now + Duration;
+    const TWeakObjectPtr<AActor> WeakTarget = Target;
+
+    int32 Row = FindRow(Target, Effect);
+    if (Row != INDEX_NONE)
+    {
+        Stacks[Row] = FMath::Min<uint8>(Stacks[Row] + 1, Definition.MaxStacks);
+        ExpiryTimes[Row] = Expiry;
+        Timers->SetTimer(ExpiryHandles[Row], Duration,
+            FSimpleDelegate::CreateUObject(this, &UStatusEffectSubsystem::OnEffectExpired, WeakTarget, Effect));
+        Magnitudes[Row] = Magnitude;
+        DamageTypes[Row] = DamageType;
+        if (Instigator)
+        {
+            Instigators[Row] = Instigator;
+        }
+    }
+    else
+    {
+        Row = ExpiryTimes.Num();
+        OwnerKeys.Add(Target);
+        Owners.Add(Target);
+        EffectIds.Add(Effect);
+        Stacks.Add(1);
+        ExpiryTimes.Add(Expiry);
+        Magnitudes.Add(Magnitude);
+        Instigators.Add(Instigator);
+        DamageTypes.Add(DamageType);
+
+        Timers->SetTimer(ExpiryHandles.AddDefaulted_GetRef(), Duration,
+            FSimpleDelegate::CreateUObject(this, &UStatusEffectSubsystem::OnEffectExpired, WeakTarget, Effect));
+
+        FCombatTimerHandle& DamageHandle = DamageHandles.AddDefaulted_GetRef();
+        if (Effect == EStatusEffect::DamageOverTime)
+        {
+            Timers->SetTimer(DamageHandle, DamageTickInterval,
+                FSimpleDelegate::CreateUObject(this, &UStatusEffectSubsystem::OnDamageTick, WeakTarget, Effect));
+        }
+
+        TArray<int32, TInlineAllocator<4>>* Rows = ActorEffects.Find(Target);
+        if (!Rows)
+        {
+            Rows = &ActorEffects.Add(Target);
+            Target->OnEndPlay.AddUniqueDynamic(this, &UStatusEffectSubsystem::OnActorEndPlay);
+        }
+        Rows->Add(Row);
+
+        if (Definition.StateFlag != ECharacterState::None)
+        {
+            if (UStateComponent* StateComp = UCombatantHandleSubsystem::Get(Target).State.Get())
+            {
+                StateComp->AddState(Definition.StateFlag);
+            }
+        }
+    }
+
+    if (Effect == EStatusEffect::Slow)
+    {
+        UpdateWalkSpeed(Target);
+    }
+}
+
+void UStatusEffectSubsystem::RemoveEffect(AActor* Target, EStatusEffect Effect)
+{
+    const int32 Row = FindRow(Target, Effect);
+    if (Row != INDEX_NONE)
+    {
+        RemoveRow(Row);
+        OnEffectRemoved(Target, Effect);
+    }
+}
+
+void UStatusEffectSubsystem::RemoveAllEffects(AActor* Target)
+{
+    TArray<EStatusEffect, TInlineAllocator<4>> Removed;
+    while (const TArray<int32, TInlineAllocator<4>>* Rows = Target ? ActorEffects.Find(Target) : nullptr)
+    {
+        const int32 Row = Rows->Last();
+        Removed.Add(EffectIds[Row]);
+        RemoveRow(Row);
+    }
+
+    for (const EStatusEffect Effect : Removed)
+    {
+        OnEffectRemoved(Target, Effect);
+    }
+}
+
+bool UStatusEffectSubsystem::HasEffect(const AActor* Target, EStatusEffect Effect) const
+{
+    return FindRow(Target, Effect) != INDEX_NONE;
+}
+
+int32 UStatusEffectSubsystem::GetStacks(const AActor* Target, EStatusEffect Effect) const
+{
+    const int32 Row = FindRow(Target, Effect);
+    return Row != INDEX_NONE ? Stacks[Row] : 0;
+}
+
+float UStatusEffectSubsystem::GetMagnitude(const AActor* Target, EStatusEffect Effect) const
+{
+    const int32 Row = FindRow(Target, Effect);
+    return Row != INDEX_NONE ? Magnitudes[Row] : 0.0f;
+}
+
+float UStatusEffectSubsystem::GetTimeRemaining(const AActor* Target, EStatusEffect Effect) const
+{
+    const int32 Row = FindRow(Target, Effect);
+    if (Row == INDEX_NONE)
+    {
+        return 0.0f;
+    }
+
+    return FMath::Max(0.0f, static_cast<float>(ExpiryTimes[Row] - GetWorld()->GetTimeSeconds()));
+}
+
+void UStatusEffectSubsystem::OnEffectExpired(TWeakObjectPtr<AActor> Target, EStatusEffect Effect)
+{
+    AActor* TargetActor = Target.Get();
+    const int32 Row = FindRow(TargetActor, Effect);
+    if (Row == INDEX_NONE)
+    {
+        return;
+    }
+
+    RemoveRow(Row);
+    TotalExpired++;
+    OnEffectRemoved(TargetActor, Effect);
+}
+
+void UStatusEffectSubsystem::OnDamageTick(TWeakObjectPtr<AActor> Target, EStatusEffect Effect)
+{
+    AActor* TargetActor = Target.Get();
+    const int32 Row = FindRow(TargetActor, Effect);
+    if (Row == INDEX_NONE)
+    {
+        return;
+    }
+
+    const FDamageInfo DamageInfo(Magnitudes[Row] * Stacks[Row] * DamageTickInterval, DamageTypes[Row], Instigators[Row].Get());
+
+    // Schedule the next tick before dealing damage; the hit may end the effect
+    if (UCombatTimerSubsystem* Timers = UCombatTimerSubsystem::Get(this))
+    {
+        Timers->SetTimer(DamageHandles[Row], DamageTickInterval,
+            FSimpleDelegate::CreateUObject(this, &UStatusEffectSubsystem::OnDamageTick, Target, Effect));
+    }
+
+    if (UHealthComponent* Health = UCombatantHandleSubsystem::Get(TargetActor).Health.Get())
+    {
+        Health->TakeDamage(DamageInfo, FVector::ZeroVector);
+        TotalDamageTicks++;
+    }
+}
+
+void UStatusEffectSubsystem::RemoveRow(int32 Row)
+{
+    if (UCombatTimerSubsystem* Timers = UCombatTimerSubsystem::Get(this))
+    {
+        Timers->ClearTimer(ExpiryHandles[Row]);
+        Timers->ClearTimer(DamageHandles[Row]);
+    }
+
+    const TObjectKey<AActor> OwnerKey = OwnerKeys[Row];
+    if (TArray<int32, TInlineAllocator<4>>* Rows = ActorEffects.Find(OwnerKey))
+    {
+        Rows->RemoveSingleSwap(Row, EAllowShrinking::No);
+        if (Rows->Num() == 0)
+        {
+            ActorEffects.Remove(OwnerKey);
+        }
+    }
+
+    // The last row moves into the hole; repoint its owner's index list
+    const int32 LastRow = ExpiryTimes.Num() - 1;
+    if (Row != LastRow)
+    {
+        if (TArray<int32, TInlineAllocator<4>>* MovedRows = ActorEffects.Find(OwnerKeys[LastRow]))
+        {
+            const int32 Slot = MovedRows->Find(LastRow);
+            if (Slot != INDEX_NONE)
+            {
+                (*MovedRows)[Slot] = Row;
+            }
+        }
+    }
+
+    OwnerKeys.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+    Owners.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+    EffectIds.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+    Stacks.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+    ExpiryTimes.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+    Magnitudes.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+    ExpiryHandles.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+    DamageHandles.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+    Instigators.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+    DamageTypes.RemoveAtSwap(Row, 1, EAllowShrinking::No);
+}
+
+void UStatusEffectSubsystem::OnEffectRemoved(AActor* Target, EStatusEffect Effect)
+{
+    const FStatusEffectDefinition& Definition = GetDefinition(Effect);
+    if (Definition.StateFlag != ECharacterState::None && !HasEffect(Target, Effect))
+    {
+        if (UStateComponent* StateComp = UCombatantHandleSubsystem::Get(Target).State.Get())
+        {
+            StateComp->RemoveState(Definition.StateFlag);
+        }
+    }
+
+    if (Effect == EStatusEffect::Slow)
+    {
+        UpdateWalkSpeed(Target);
+    }
+}
+
+void UStatusEffectSubsystem::UpdateWalkSpeed(AActor* Target)
+{
+    ACharacter* Character = Cast<ACharacter>(Target);
+    UCharacterMovementComponent* Movement = Character ? Character->GetCharacterMovement() : nullptr;
+    if (!Movement)
+    {
+        return;
+    }
+
+    const int32 Row = FindRow(Target, EStatusEffect::Slow);
+    const float SpeedScale = Row != INDEX_NONE ? FMath::Max(MinSlowedSpeedScale, 1.0f - Magnitudes[Row] * Stacks[Row]) : 1.0f;
+
+    // Swap our previous scale for the new one instead of writing an absolute speed, so changes other
+    // systems made to the walk speed while slowed survive the slow ending
+    const float* AppliedScale = AppliedSlowScales.Find(Target);
+    Movement->MaxWalkSpeed *= SpeedScale / (AppliedScale ? *AppliedScale : 1.0f);
+
+    if (Row != INDEX_NONE)
+    {
+        AppliedSlowScales.Add(Target, SpeedScale);
+    }
+    else
+    {
+        AppliedSlowScales.Remove(Target);
+    }
+}
+
+void UStatusEffectSubsystem::OnActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+    // The actor is leaving; drop its rows without touching its components
+    while (const TArray<int32, TInlineAllocator<4>>* Rows = ActorEffects.Find(Actor))
+    {
+        RemoveRow(Rows->Last());
+    }
+    AppliedSlowScales.Remove(Actor);
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorld StatusEffectStatsCommand(
+    TEXT("TrinityFlow.StatusEffects.Stats"),
+    TEXT("Logs active status effects and the expiries and damage ticks processed so far"),
+    FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+    {
+        if (UStatusEffectSubsystem* Effects = World ? World->GetSubsystem<UStatusEffectSubsystem>() : nullptr)
+        {
+            UE_LOG(LogTemp, Log, TEXT("Status effects: %d active on %d actors, %llu expired and %llu damage ticks in total"),
+                Effects->GetNumEffects(), Effects->GetNumAffectedActors(),
+                Effects->GetTotalExpired(), Effects->GetTotalDamageTicks());
+        }
+    }));
+#endif
@@ -1,4 +1,5 @@
 #include "Core/TagComponent.h"
+#include "Core/CombatAttributeSubsystem.h"
 
 UTagComponent::UTagComponent()
 {
@@ -8,11 +9,19 @@ UTagComponent::UTagComponent()
 void UTagComponent::AddTag(ECharacterTag Tag)
 {
     Tags = Tags | Tag;
+    UCombatAttributeSubsystem::NotifySourceChanged(this);
 }
 
 void UTagComponent::RemoveTag(ECharacterTag Tag)
 {
     Tags = Tags & ~Tag;
+    UCombatAttributeSubsystem::NotifySourceChanged(this);
+}
+
+void UTagComponent::SetTags(ECharacterTag NewTags)
+{
+    Tags = NewTags;
+    UCombatAttributeSubsystem::NotifySourceChanged(this);
 }
 
 bool UTagComponent::HasTag(ECharacterTag Tag) const
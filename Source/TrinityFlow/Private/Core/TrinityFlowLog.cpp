@@ -0,0 +1,6 @@
+#include "Core/TrinityFlowLog.h"
+
+DEFINE_LOG_CATEGORY(LogTrinityFlowCombat);
+DEFINE_LOG_CATEGORY(LogTrinityFlowAI);
+DEFINE_LOG_CATEGORY(LogTrinityFlowUI);
+DEFINE_LOG_CATEGORY(LogTrinityFlowData);
@@ -0,0 +1,29 @@
+#include "Core/TrinityFlowProfiling.h"
+
+DEFINE_STAT(STAT_TrinityFlow_DamageResolution);
+DEFINE_STAT(STAT_TrinityFlow_DamageRequests);
+
+DEFINE_STAT(STAT_TrinityFlow_AIIdle);
+DEFINE_STAT(STAT_TrinityFlow_AIChase);
+DEFINE_STAT(STAT_TrinityFlow_AIAttack);
+DEFINE_STAT(STAT_TrinityFlow_AIDecisions);
+DEFINE_STAT(STAT_TrinityFlow_PerceptionDispatch);
+DEFINE_STAT(STAT_TrinityFlow_PerceptionTraces);
+DEFINE_STAT(STAT_TrinityFlow_PathDispatch);
+DEFINE_STAT(STAT_TrinityFlow_PathApply);
+DEFINE_STAT(STAT_TrinityFlow_PathRequests);
+
+DEFINE_STAT(STAT_TrinityFlow_HUDTick);
+DEFINE_STAT(STAT_TrinityFlow_HUDProjection);
+DEFINE_STAT(STAT_TrinityFlow_HUDAnchorsProjected);
+DEFINE_STAT(STAT_TrinityFlow_EnemyInfoPanels);
+DEFINE_STAT(STAT_TrinityFlow_DamageNumberPaint);
+DEFINE_STAT(STAT_TrinityFlow_DamageNumbersPainted);
+DEFINE_STAT(STAT_TrinityFlow_HUDWidgets);
+DEFINE_STAT(STAT_TrinityFlow_HUDWidgetInvalidations);
+
+DEFINE_STAT(STAT_TrinityFlow_StatsLoading);
+
+CSV_DEFINE_CATEGORY_MODULE(TRINITYFLOW_API, TrinityFlow, true);
+
+UE_TRACE_CHANNEL_DEFINE(TrinityFlowChannel);
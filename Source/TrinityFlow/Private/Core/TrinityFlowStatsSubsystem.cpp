@@ -1,9 +1,11 @@
 #include "Core/TrinityFlowStatsSubsystem.h"
+#include "Core/TrinityFlowProfiling.h"
 #include "Core/TrinityFlowGameInstance.h"
 #include "Data/TrinityFlowCharacterStats.h"
 #include "Data/TrinityFlowWeaponStatsBase.h"
 #include "Data/TrinityFlowKatanaStats.h"
 #include "Data/TrinityFlowPhysicalKatanaStats.h"
+#include "Data/TrinityFlowTagData.h"
 #include "Engine/DataTable.h"
 #include "Engine/Engine.h"
 
@@ -22,11 +24,13 @@ void UTrinityFlowStatsSubsystem::Initialize(FSubsystemCollectionBase& Collection
     // Load all stats on initialization
     LoadCharacterStats();
     LoadWeaponStats();
+    LoadTagTable();
 }
 
 void UTrinityFlowStatsSubsystem::Deinitialize()
 {
     ClearCache();
+    FCompiledTagTable::SetActive(nullptr);
     Super::Deinitialize();
 }
 
@@ -133,10 +137,13 @@ void UTrinityFlowStatsSubsystem::ReloadAllStats()
     ClearCache();
     LoadCharacterStats();
     LoadWeaponStats();
+    LoadTagTable();
 }
 
 void UTrinityFlowStatsSubsystem::LoadCharacterStats()
 {
+    TRINITYFLOW_SCOPE_CYCLE_COUNTER(StatsLoading);
+
     // Load default player stats
     if (DefaultPlayerStats.IsValid())
     {
@@ -171,6 +178,8 @@ void UTrinityFlowStatsSubsystem::LoadCharacterStats()
 
 void UTrinityFlowStatsSubsystem::LoadWeaponStats()
 {
+    TRINITYFLOW_SCOPE_CYCLE_COUNTER(StatsLoading);
+
     UE_LOG(LogTemp, Log, TEXT("Loading weapon stats..."));
     
     // Load default weapon stats
@@ -223,6 +232,20 @@ void UTrinityFlowStatsSubsystem::LoadWeaponStats()
     }
 }
 
+void UTrinityFlowStatsSubsystem::LoadTagTable()
+{
+    TRINITYFLOW_SCOPE_CYCLE_COUNTER(StatsLoading);
+
+    // Compile tag rows into the flat table used by damage calculation; built-in rules without a table
+    UDataTable* Table = TagDataTable.IsNull() ? nullptr : TagDataTable.LoadSynchronous();
+    FCompiledTagTable::SetActive(FCompiledTagTable::Compile(Table));
+
+    if (Table)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Compiled tag table from %s"), *Table->GetName());
+    }
+}
+
 void UTrinityFlowStatsSubsystem::ClearCache()
 {
     LoadedCharacterStats.Empty();
@@ -249,6 +272,11 @@ void UTrinityFlowStatsSubsystem::ConfigureFromGameInstance(UTrinityFlowGameInsta
         WeaponStatsTable = GameInstance->WeaponStatsTable;
     }
     
+    if (GameInstance->TagDataTable)
+    {
+        TagDataTable = GameInstance->TagDataTable;
+    }
+    
     if (GameInstance->DefaultPlayerStats)
     {
         DefaultPlayerStats = GameInstance->DefaultPlayerStats;
@@ -1,6 +1,279 @@
 #include "Data/TrinityFlowTagData.h"
 #include "Engine/DataTable.h"
 
+namespace
+{
+    struct FCompiledTagTableEntry
+    {
+        TSharedPtr<FCompiledTagTable> Table;
+        FDelegateHandle ChangedHandle;
+    };
+
+    TSharedPtr<FCompiledTagTable> ActiveTagTable;
+    uint32 ActiveTagTableVersion = 0;
+    TMap<TWeakObjectPtr<const UDataTable>, FCompiledTagTableEntry> CompiledTagTables;
+
+    uint8 DamageTypeBit(EDamageType Type)
+    {
+        return static_cast<uint8>(1 << static_cast<uint8>(Type));
+    }
+
+    // Rows were edited or reimported: recompile, and swap the active table if it came from this DataTable
+    void OnTagDataTableChanged(TWeakObjectPtr<const UDataTable> WeakDataTable)
+    {
+        const UDataTable* DataTable = WeakDataTable.Get();
+        const FCompiledTagTableEntry* Entry = CompiledTagTables.Find(WeakDataTable);
+        if (!DataTable || !Entry)
+        {
+            return;
+        }
+
+        const bool bWasActive = Entry->Table.IsValid() && Entry->Table == ActiveTagTable;
+        const TSharedRef<FCompiledTagTable> Table = FCompiledTagTable::Compile(DataTable);
+        if (bWasActive)
+        {
+            FCompiledTagTable::SetActive(Table);
+        }
+    }
+
+    void CacheCompiledTable(const UDataTable* DataTable, const TSharedRef<FCompiledTagTable>& Table)
+    {
+        // DataTables that were garbage collected leave dead keys behind
+        for (auto It = CompiledTagTables.CreateIterator(); It; ++It)
+        {
+            if (!It.Key().IsValid())
+            {
+                It.RemoveCurrent();
+            }
+        }
+
+        FCompiledTagTableEntry& Entry = CompiledTagTables.FindOrAdd(DataTable);
+        Entry.Table = Table;
+        if (!Entry.ChangedHandle.IsValid())
+        {
+            Entry.ChangedHandle = const_cast<UDataTable*>(DataTable)->OnDataTableChanged().AddStatic(
+                &OnTagDataTableChanged, TWeakObjectPtr<const UDataTable>(DataTable));
+        }
+    }
+}
+
+FCompiledTagTable::FCompiledTagTable()
+{
+    const UEnum* TagEnum = StaticEnum<ECharacterTag>();
+
+    for (int32 Bit = 0; Bit < NumTagBits; Bit++)
+    {
+        const int64 Value = 1LL << Bit;
+        Bits[Bit].TagName = FName(*TagEnum->GetNameStringByValue(Value));
+        Bits[Bit].DisplayName = TagEnum->GetDisplayNameTextByValue(Value).ToString();
+    }
+
+    // Built-in rules, used for any tag the DataTable does not define
+    FTagBitData& Ghost = Bits[FMath::CountTrailingZeros(static_cast<uint32>(ECharacterTag::Ghost))];
+    Ghost.EffectType = ETagEffectType::DamageImmunity;
+    Ghost.ImmunityMask = DamageTypeBit(EDamageType::Physical);
+
+    FTagBitData& Mechanical = Bits[FMath::CountTrailingZeros(static_cast<uint32>(ECharacterTag::Mechanical))];
+    Mechanical.EffectType = ETagEffectType::DamageImmunity;
+    Mechanical.ImmunityMask = DamageTypeBit(EDamageType::Soul);
+
+    FTagBitData& Shielded = Bits[FMath::CountTrailingZeros(static_cast<uint32>(ECharacterTag::Shielded))];
+    Shielded.EffectType = ETagEffectType::DirectionalBlock;
+    Shielded.bBlockFromFront = true;
+
+    BakeMasks();
+}
+
+TSharedRef<FCompiledTagTable> FCompiledTagTable::Compile(const UDataTable* TagDataTable)
+{
+    TSharedRef<FCompiledTagTable> Table = MakeShared<FCompiledTagTable>();
+    if (!TagDataTable)
+    {
+        return Table;
+    }
+
+    // Resolve all rows first so conflict/requirement names can reference any tag
+    TArray<TPair<int32, const FCharacterTagData*>> Rows;
+    TagDataTable->ForeachRow<FCharacterTagData>(TEXT("CompileTagTable"), [&Table, &Rows](const FName& RowName, const FCharacterTagData& Row)
+    {
+        const FName TagName = Row.TagName.IsNone() ? RowName : Row.TagName;
+        const int32 Bit = Table->FindTagBit(TagName);
+        if (Bit == INDEX_NONE)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("CompileTagTable: %s is not an ECharacterTag, row ignored"), *TagName.ToString());
+            return;
+        }
+
+        Rows.Emplace(Bit, &Row);
+    });
+
+    for (const TPair<int32, const FCharacterTagData*>& Entry : Rows)
+    {
+        const FCharacterTagData& Row = *Entry.Value;
+        FTagBitData& BitData = Table->Bits[Entry.Key];
+
+        if (!Row.DisplayName.IsEmpty())
+        {
+            BitData.DisplayName = Row.DisplayName;
+        }
+
+        // A row without an effect only adds display data and rules; the built-in effect stays
+        if (Row.EffectType != ETagEffectType::None)
+        {
+            BitData.EffectType = Row.EffectType;
+            BitData.ImmunityMask = Row.EffectType == ETagEffectType::DamageImmunity ? DamageTypeBit(Row.ImmunityType) : 0;
+            BitData.ReductionPercent = FMath::Clamp(Row.ReductionPercent, 0.0f, 100.0f);
+            BitData.DamageMultiplier = Row.DamageMultiplier;
+            BitData.bBlockFromFront = Row.bBlockFromFront;
+        }
+
+        BitData.ConflictMask = 0;
+        for (const FName& ConflictTag : Row.ConflictingTags)
+        {
+            const int32 ConflictBit = Table->FindTagBit(ConflictTag);
+            if (ConflictBit != INDEX_NONE)
+            {
+                BitData.ConflictMask |= 1 << ConflictBit;
+            }
+        }
+
+        BitData.RequirementMask = 0;
+        for (const FName& RequiredTag : Row.RequiredTags)
+        {
+            const int32 RequiredBit = Table->FindTagBit(RequiredTag);
+            if (RequiredBit != INDEX_NONE)
+            {
+                BitData.RequirementMask |= 1 << RequiredBit;
+            }
+        }
+    }
+
+    Table->BakeMasks();
+    CacheCompiledTable(TagDataTable, Table);
+    return Table;
+}
+
+TSharedRef<FCompiledTagTable> FCompiledTagTable::FindOrCompile(const UDataTable* TagDataTable)
+{
+    const FCompiledTagTableEntry* Found = TagDataTable ? CompiledTagTables.Find(TagDataTable) : nullptr;
+    if (Found && Found->Table.IsValid())
+    {
+        return Found->Table.ToSharedRef();
+    }
+
+    return Compile(TagDataTable);
+}
+
+const FCompiledTagTable& FCompiledTagTable::Get()
+{
+    if (!ActiveTagTable.IsValid())
+    {
+        ActiveTagTable = MakeShared<FCompiledTagTable>();
+    }
+
+    return *ActiveTagTable;
+}
+
+void FCompiledTagTable::SetActive(TSharedPtr<FCompiledTagTable> NewTable)
+{
+    check(IsInGameThread());
+    ActiveTagTable = NewTable;
+    ActiveTagTableVersion++;
+}
+
+uint32 FCompiledTagTable::GetActiveVersion()
+{
+    return ActiveTagTableVersion;
+}
+
+bool FCompiledTagTable::MakeTagMask(const TArray<FName>& TagNames, ECharacterTag& OutTags) const
+{
+    uint8 Mask = 0;
+    bool bAllKnown = true;
+
+    for (const FName& TagName : TagNames)
+    {
+        const int32 Bit = FindTagBit(TagName);
+        if (Bit == INDEX_NONE)
+        {
+            bAllKnown = false;
+            continue;
+        }
+
+        Mask |= 1 << Bit;
+    }
+
+    OutTags = static_cast<ECharacterTag>(Mask);
+    return bAllKnown;
+}
+
+int32 FCompiledTagTable::FindTagBit(FName TagName) const
+{
+    for (int32 Bit = 0; Bit < NumTagBits; Bit++)
+    {
+        if (Bits[Bit].TagName == TagName)
+        {
+            return Bit;
+        }
+    }
+
+    return INDEX_NONE;
+}
+
+void FCompiledTagTable::BakeMasks()
+{
+    const uint8 PhysicalBit = DamageTypeBit(EDamageType::Physical);
+    TArray<FString> DisplayNames;
+
+    for (int32 Mask = 0; Mask < NumTagMasks; Mask++)
+    {
+        FCompiledTagEffects Effects;
+        DisplayNames.Reset();
+
+        for (int32 Bit = 0; Bit < NumTagBits; Bit++)
+        {
+            if ((Mask & (1 << Bit)) == 0)
+            {
+                continue;
+            }
+
+            const FTagBitData& BitData = Bits[Bit];
+            Effects.ConflictMask |= BitData.ConflictMask;
+            Effects.RequirementMask |= BitData.RequirementMask;
+            DisplayNames.Add(BitData.DisplayName);
+
+            switch (BitData.EffectType)
+            {
+                case ETagEffectType::DamageImmunity:
+                    Effects.ImmunityMask |= BitData.ImmunityMask;
+                    break;
+
+                case ETagEffectType::DamageReduction:
+                    // Soul damage bypasses defences, so reductions only apply to physical hits
+                    Effects.DamageMultipliers[static_cast<uint8>(EDamageType::Physical)] *= (100.0f - BitData.ReductionPercent) / 100.0f;
+                    break;
+
+                case ETagEffectType::DirectionalBlock:
+                    (BitData.bBlockFromFront ? Effects.FrontBlockMask : Effects.BackBlockMask) |= PhysicalBit;
+                    break;
+
+                case ETagEffectType::DamageModifier:
+                    for (int32 Type = 0; Type < NumDamageTypes; Type++)
+                    {
+                        Effects.DamageMultipliers[Type] *= BitData.DamageMultiplier;
+                    }
+                    break;
+
+                default:
+                    break;
+            }
+        }
+
+        MaskEffects[Mask] = Effects;
+        DisplayStrings[Mask] = FString::Join(DisplayNames, TEXT(", "));
+    }
+}
+
 FCharacterTagData UTrinityFlowTagManager::GetTagData(UDataTable* TagDataTable, FName TagName)
 {
     if (!TagDataTable)
@@ -47,39 +320,25 @@ bool UTrinityFlowTagManager::ValidateTagCombination(UDataTable* TagDataTable, co
         return true; // No validation without data
     }
 
-    // Check for conflicts
-    for (const FName& Tag : Tags)
-    {
-        FCharacterTagData* TagData = TagDataTable->FindRow<FCharacterTagData>(Tag, TEXT("ValidateTag"));
-        if (TagData)
-        {
-            // Check conflicts
-            for (const FName& ConflictTag : TagData->ConflictingTags)
-            {
-                if (Tags.Contains(ConflictTag))
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("Tag conflict: %s conflicts with %s"), 
-                        *Tag.ToString(), *ConflictTag.ToString());
-                    return false;
-                }
-            }
+    const TSharedRef<FCompiledTagTable> Table = FCompiledTagTable::FindOrCompile(TagDataTable);
 
-            // Check requirements
-            for (const FName& RequiredTag : TagData->RequiredTags)
-            {
-                if (!Tags.Contains(RequiredTag))
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("Tag requirement not met: %s requires %s"), 
-                        *Tag.ToString(), *RequiredTag.ToString());
-                    return false;
-                }
-            }
-        }
+    ECharacterTag Mask;
+    Table->MakeTagMask(Tags, Mask);
+
+    if (!Table->IsValidCombination(Mask))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Invalid tag combination: %s"), *Table->GetDisplayString(Mask));
+        return false;
     }
 
     return true;
 }
 
+bool UTrinityFlowTagManager::ValidateTagMask(ECharacterTag Tags)
+{
+    return FCompiledTagTable::Get().IsValidCombination(Tags);
+}
+
 FString UTrinityFlowTagManager::GetTagDisplayString(UDataTable* TagDataTable, const TArray<FName>& Tags)
 {
     TArray<FString> DisplayNames;
@@ -93,6 +352,29 @@ FString UTrinityFlowTagManager::GetTagDisplayString(UDataTable* TagDataTable, co
         }
         return FString::Join(DisplayNames, TEXT(", "));
     }
+
+    const TSharedRef<FCompiledTagTable> Table = FCompiledTagTable::FindOrCompile(TagDataTable);
+
+    // Known tags listed in bit order hit the per-mask cache
+    uint8 Mask = 0;
+    int32 LastBit = INDEX_NONE;
+    for (const FName& Tag : Tags)
+    {
+        const int32 Bit = Table->FindTagBit(Tag);
+        if (Bit <= LastBit)
+        {
+            LastBit = INDEX_NONE;
+            break;
+        }
+
+        Mask |= 1 << Bit;
+        LastBit = Bit;
+    }
+
+    if (LastBit != INDEX_NONE || Tags.Num() == 0)
+    {
+        return Table->GetDisplayString(static_cast<ECharacterTag>(Mask));
+    }
     
     for (const FName& Tag : Tags)
     {
@@ -108,4 +390,9 @@ FString UTrinityFlowTagManager::GetTagDisplayString(UDataTable* TagDataTable, co
     }
 
     return FString::Join(DisplayNames, TEXT(", "));
-}
\ No newline at end of file
+}
+
+const FString& UTrinityFlowTagManager::GetTagMaskDisplayString(ECharacterTag Tags)
+{
+    return FCompiledTagTable::Get().GetDisplayString(Tags);
+}
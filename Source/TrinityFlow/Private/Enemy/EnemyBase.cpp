@@ -4,15 +4,17 @@
 #include "Core/StateComponent.h"
 #include "Core/CombatComponent.h"
 #include "Core/CombatStateManager.h"
+#include "Core/CombatantHandleSubsystem.h"
 #include "Core/TrinityFlowStatsSubsystem.h"
 #include "Data/TrinityFlowCharacterStats.h"
-#include "../../TrinityFlowCharacter.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "AI/AIStateMachine.h"
 #include "AI/EnemyAIController.h"
 #include "AI/AIState.h"
+#include "AI/EnemyPerceptionSubsystem.h"
+#include "AI/EnemySignificanceSubsystem.h"
 #include "Enemy/EnemyAnimationComponent.h"
 #include "UI/TrinityFlowUIManager.h"
 #include "DrawDebugHelpers.h"
@@ -96,6 +98,24 @@ void AEnemyBase::BeginPlay()
         }
     }
 
+    // Resolve combat component handles once for hit paths
+    if (UCombatantHandleSubsystem* Handles = GetWorld()->GetSubsystem<UCombatantHandleSubsystem>())
+    {
+        Handles->Register(this);
+    }
+
+    // Shared line-of-sight record
+    if (UEnemyPerceptionSubsystem* Perception = GetWorld()->GetSubsystem<UEnemyPerceptionSubsystem>())
+    {
+        Perception->Register(this);
+    }
+
+    // Tick rate follows distance and combat relevance
+    if (UEnemySignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UEnemySignificanceSubsystem>())
+    {
+        Significance->Register(this);
+    }
+
     // Register with combat state manager
     if (UCombatStateManager* CombatManager = GetWorld()->GetSubsystem<UCombatStateManager>())
     {
@@ -110,25 +130,6 @@ void AEnemyBase::BeginPlay()
             UIManager->RegisterEnemy(this);
         }
     }
-    
-    // Register damage events with player for echo system
-    // Do this with a small delay to ensure everything is initialized
-    FTimerHandle TimerHandle;
-    GetWorld()->GetTimerManager().SetTimer(TimerHandle, [this]()
-    {
-        if (PlayerTarget)
-        {
-            UE_LOG(LogTemp, Warning, TEXT("Enemy %s attempting to register with player"), *GetName());
-            if (ATrinityFlowCharacter* TrinityCharacter = Cast<ATrinityFlowCharacter>(PlayerTarget))
-            {
-                TrinityCharacter->RegisterEnemyDamageEvents(this);
-            }
-        }
-        else
-        {
-            UE_LOG(LogTemp, Warning, TEXT("Enemy %s could not find player target"), *GetName());
-        }
-    }, 0.1f, false);
 }
 
 void AEnemyBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -256,30 +257,9 @@ bool AEnemyBase::CanSeePlayer()
         return false;
     }
 
-    // Check cache validity
-    float CurrentTime = GetWorld()->GetTimeSeconds();
-    if (CurrentTime - LastVisibilityCheck < VisibilityCacheTime)
-    {
-        return bCachedCanSeePlayer;
-    }
-
-    // Perform line trace and cache result
-    LastVisibilityCheck = CurrentTime;
-
-    FHitResult Hit;
-    FCollisionQueryParams QueryParams;
-    QueryParams.AddIgnoredActor(this);
-
-    bool bHit = GetWorld()->LineTraceSingleByChannel(
-        Hit,
-        GetActorLocation() + FVector(0, 0, 50), // Eye height
-        PlayerTarget->GetActorLocation(),
-        ECC_Visibility,
-        QueryParams
-    );
-
-    bCachedCanSeePlayer = !bHit || Hit.GetActor() == PlayerTarget;
-    return bCachedCanSeePlayer;
+    // Line of sight comes from the shared perception records
+    UEnemyPerceptionSubsystem* Perception = GetWorld()->GetSubsystem<UEnemyPerceptionSubsystem>();
+    return Perception && Perception->GetVisibility(this, PlayerTarget) == EEnemyVisibility::Visible;
 }
 
 void AEnemyBase::UpdateCombatState()
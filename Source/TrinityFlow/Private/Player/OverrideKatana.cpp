@@ -1,7 +1,9 @@
 #include "Player/OverrideKatana.h"
+#include "AI/EnemyHordeSubsystem.h"
 #include "Combat/AbilityComponent.h"
 #include "Core/HealthComponent.h"
 #include "Core/StateComponent.h"
+#include "Core/CombatantHandleSubsystem.h"
 #include "Core/TrinityFlowStatsSubsystem.h"
 #include "Data/TrinityFlowKatanaStats.h"
 #include "DrawDebugHelpers.h"
@@ -10,6 +12,9 @@
 
 AOverrideKatana::AOverrideKatana()
 {
+    // Ticks for the dodge window; ability cooldowns run on the combat timer wheel
+    PrimaryActorTick.bCanEverTick = true;
+
     // Default values - will be overridden by stats subsystem
     BasicAttackRange = 300.0f;
     BasicAttackSpeed = 1.0f;
@@ -87,24 +92,28 @@ void AOverrideKatana::BeginPlay()
 void AOverrideKatana::AbilityQ(AActor* Target)
 {
     // Code Break - Enhanced slash with soul damage (moved from E)
-    if (!IsAbilityQReady() || !Target)
+    if (!IsAbilityQReady())
     {
         return;
     }
 
-    float Distance = FVector::Dist(GetActorLocation(), Target->GetActorLocation());
     float CodeBreakRange = KatanaStats ? KatanaStats->CodeBreakRange : 600.0f;
+
+    if (!Target)
+    {
+        CodeBreakHorde(CodeBreakRange);
+        return;
+    }
+
+    float Distance = FVector::Dist(GetActorLocation(), Target->GetActorLocation());
     if (Distance > CodeBreakRange)
     {
         return;
     }
 
-    if (UHealthComponent* TargetHealth = Target->FindComponentByClass<UHealthComponent>())
+    if (UHealthComponent* TargetHealth = UCombatantHandleSubsystem::Get(Target).Health.Get())
     {
-        FDamageInfo DamageInfo;
-        DamageInfo.Amount = OwnerHealthComponent ? OwnerHealthComponent->GetResources().AttackPoint : 20.0f;
-        DamageInfo.Type = EDamageType::Soul; // Code Break deals soul damage
-        DamageInfo.Instigator = OwnerPawn;
+        const FDamageInfo DamageInfo = MakeAttackDamage(EDamageType::Soul); // Code Break deals soul damage
 
         FVector DamageDirection = (Target->GetActorLocation() - GetActorLocation()).GetSafeNormal();
         TargetHealth->TakeDamage(DamageInfo, DamageDirection);
@@ -115,7 +124,25 @@ void AOverrideKatana::AbilityQ(AActor* Target)
 #endif
     }
 
-    StartCooldown(AbilityQCooldownTimer, AbilityQCooldown);
+    StartCooldown(AbilityQCooldownHandle, AbilityQCooldown);
+}
+
+void AOverrideKatana::CodeBreakHorde(float CodeBreakRange)
+{
+    UEnemyHordeSubsystem* Horde = UEnemyHordeSubsystem::Get(this);
+    if (!Horde || !OwnerPawn)
+    {
+        return;
+    }
+
+    const FHordeEntityId Entity = Horde->FindEntityInCone(OwnerPawn->GetActorLocation(),
+        OwnerPawn->GetBaseAimRotation().Vector(), CodeBreakRange, HordeAttackHalfAngle);
+    if (!HitHordeEntity(Entity, EDamageType::Soul, CodeBreakRange, FColor::Cyan))
+    {
+        return;
+    }
+
+    StartCooldown(AbilityQCooldownHandle, AbilityQCooldown);
 }
 
 void AOverrideKatana::AbilityTab(AActor* Target)
@@ -143,7 +170,7 @@ void AOverrideKatana::AbilityTab(AActor* Target)
         UE_LOG(LogTemp, Error, TEXT("Echoes of Data: No AbilityComponent found!"));
     }
 
-    StartCooldown(AbilityECooldownTimer, AbilityECooldown);  // Using E cooldown for Tab
+    StartCooldown(AbilityECooldownHandle, AbilityECooldown);  // Using E cooldown for Tab
 
 #if !UE_BUILD_SHIPPING
     // Visual feedback
@@ -173,7 +200,7 @@ void AOverrideKatana::DefensiveAbility()
 void AOverrideKatana::OnPerfectDodge()
 {
     // Reset Code Break cooldown on perfect dodge
-    AbilityECooldownTimer = 0.0f;
+    ResetCooldown(AbilityECooldownHandle);
 
 #if !UE_BUILD_SHIPPING
     // Visual feedback
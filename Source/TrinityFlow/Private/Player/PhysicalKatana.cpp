@@ -1,6 +1,7 @@
 #include "Player/PhysicalKatana.h"
 #include "Core/HealthComponent.h"
 #include "Core/TagComponent.h"
+#include "Core/CombatantHandleSubsystem.h"
 #include "Core/TrinityFlowStatsSubsystem.h"
 #include "Data/TrinityFlowPhysicalKatanaStats.h"
 #include "GameFramework/Character.h"
@@ -74,7 +75,7 @@ void APhysicalKatana::AbilityE(AActor* Target)
     }
     
     UE_LOG(LogTemp, Log, TEXT("PhysicalKatana Ability E - Not yet implemented"));
-    StartCooldown(AbilityECooldownTimer, AbilityECooldown);
+    StartCooldown(AbilityECooldownHandle, AbilityECooldown);
 }
 
 void APhysicalKatana::AbilityR(AActor* Target)
@@ -236,7 +237,7 @@ void APhysicalKatana::PerformCounterAttack(AActor* Target)
     const float DefaultCounterArmorReduction = 0.25f;
     float ArmorReduction = PhysicalKatanaStats ? PhysicalKatanaStats->CounterArmorReduction : DefaultCounterArmorReduction;
     
-    if (UTagComponent* TargetTags = Target->FindComponentByClass<UTagComponent>())
+    if (UTagComponent* TargetTags = UCombatantHandleSubsystem::Get(Target).Tags.Get())
     {
         if (TargetTags->HasTag(ECharacterTag::Shielded))
         {
@@ -247,7 +248,7 @@ void APhysicalKatana::PerformCounterAttack(AActor* Target)
         else
         {
             // Reduce armor by percentage
-            if (UHealthComponent* TargetHealth = Target->FindComponentByClass<UHealthComponent>())
+            if (UHealthComponent* TargetHealth = UCombatantHandleSubsystem::Get(Target).Health.Get())
             {
                 FCharacterResources Resources = TargetHealth->GetResources();
                 float CurrentDefense = Resources.DefencePoint;
@@ -0,0 +1,183 @@
+#include "UI/Slate/STrinityFlowDamageNumberLayer.h"
+#include "UI/TrinityFlowStyle.h"
+#include "UI/TrinityFlowHUDProjection.h"
+#include "Core/TrinityFlowProfiling.h"
+#include "Framework/Application/SlateApplication.h"
+
+#define LOCTEXT_NAMESPACE "TrinityFlowDamageNumber"
+
+void STrinityFlowDamageNumberLayer::Construct(const FArguments& InArgs)
+{
+    Projection = InArgs._Projection;
+    Entries.SetNum(Capacity);
+
+    // Damage numbers scale from 20 to 60 points; one font per 4 point step
+    const FSlateFontInfo BaseFont = FTrinityFlowStyle::Get().GetFontStyle("TrinityFlow.Font.DamageNumber");
+    Fonts.Reserve(NumFontSteps);
+    for (int32 Step = 0; Step < NumFontSteps; Step++)
+    {
+        FSlateFontInfo Font = BaseFont;
+        Font.Size = 20 + Step * 4;
+        Fonts.Add(Font);
+    }
+
+    // Numbers move every frame; nothing here is worth caching between paints
+    SetCanTick(false);
+    ForceVolatile(true);
+}
+
+void STrinityFlowDamageNumberLayer::RefreshEntry(FDamageNumberEntry& Entry) const
+{
+    const int32 RoundedDamage = FMath::RoundToInt(Entry.Damage);
+    if (Entry.bIsEcho)
+    {
+        Entry.Text = FText::Format(LOCTEXT("EchoDamage", "ECHO {0}"), RoundedDamage).ToString();
+        Entry.Color = FLinearColor(0.0f, 0.8f, 1.0f); // Bright blue for echo
+    }
+    else
+    {
+        Entry.Text = FText::AsNumber(RoundedDamage).ToString();
+        Entry.Color = Entry.DamageType == EDamageType::Soul
+            ? FLinearColor(0.0f, 0.6f, 1.0f)  // Blue for soul damage
+            : FLinearColor(1.0f, 0.4f, 0.0f); // Orange for physical damage
+    }
+
+    const float FontSize = FMath::Clamp(20.0f + (Entry.Damage / 50.0f) * 10.0f, 20.0f, 60.0f);
+    Entry.FontIndex = FMath::Clamp(FMath::RoundToInt((FontSize - 20.0f) / 4.0f), 0, NumFontSteps - 1);
+}
+
+void STrinityFlowDamageNumberLayer::AddDamageNumber(const FVector& WorldLocation, float Damage, bool bIsEcho, EDamageType DamageType,
+    const AActor* Target, float HorizontalOffset)
+{
+    const double Now = FSlateApplication::Get().GetCurrentTime();
+    const FObjectKey TargetKey(Target);
+
+    // Fold rapid hits on the same target into the number already floating above it
+    if (Target)
+    {
+        for (int32 Depth = 1; Depth <= MergeSearchDepth; Depth++)
+        {
+            FDamageNumberEntry& Entry = Entries[(Head - Depth + Capacity) % Capacity];
+            if (Entry.Target == TargetKey && Entry.bIsEcho == bIsEcho && Entry.DamageType == DamageType
+                && Entry.ExpireTime > Now && Now - Entry.LastHitTime <= MergeWindow
+                && Now + LifeTime <= Entry.StartTime + MaxMergedLifeTime)
+            {
+                Entry.Damage += Damage;
+                Entry.LastHitTime = Now;
+                Entry.ExpireTime = Now + LifeTime;
+                LatestExpireTime = Entry.ExpireTime;
+                RefreshEntry(Entry);
+                return;
+            }
+        }
+    }
+
+    FDamageNumberEntry& Entry = Entries[Head];
+    Head = (Head + 1) % Capacity;
+
+    Entry.WorldLocation = WorldLocation;
+    Entry.Target = TargetKey;
+    Entry.Damage = Damage;
+    Entry.HorizontalOffset = HorizontalOffset;
+    Entry.StartTime = Now;
+    Entry.LastHitTime = Now;
+    Entry.ExpireTime = Now + LifeTime;
+    LatestExpireTime = Entry.ExpireTime;
+    Entry.DamageType = DamageType;
+    Entry.bIsEcho = bIsEcho;
+    RefreshEntry(Entry);
+}
+
+int32 STrinityFlowDamageNumberLayer::GetNumLive() const
+{
+    const double Now = FSlateApplication::Get().GetCurrentTime();
+
+    int32 NumLive = 0;
+    for (const FDamageNumberEntry& Entry : Entries)
+    {
+        NumLive += Entry.ExpireTime > Now ? 1 : 0;
+    }
+    return NumLive;
+}
+
+int32 STrinityFlowDamageNumberLayer::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+    FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+    TRINITYFLOW_SCOPE_CYCLE_COUNTER(DamageNumberPaint);
+
+    const double Now = Args.GetCurrentTime();
+    if (LatestExpireTime <= Now)
+    {
+        return LayerId;
+    }
+
+    if (!Projection.IsValid() || !Projection->HasView())
+    {
+        return LayerId;
+    }
+
+    // Gather the live numbers and project them in one batch
+    PaintEntries.Reset();
+    PaintWorldPoints.Reset();
+    for (int32 Index = 0; Index < Entries.Num(); Index++)
+    {
+        const FDamageNumberEntry& Entry = Entries[Index];
+        if (Entry.ExpireTime <= Now)
+        {
+            continue;
+        }
+
+        // Float upward from above the hit location
+        const float Age = static_cast<float>(Now - Entry.StartTime);
+        PaintEntries.Add(Index);
+        PaintWorldPoints.Add(Entry.WorldLocation + FVector(Entry.HorizontalOffset, 0.0f, 100.0f + 50.0f * Age));
+    }
+
+    Projection->ProjectPoints(PaintWorldPoints, PaintPositions, PaintFlags);
+
+    int32 NumPainted = 0;
+    for (int32 PaintIndex = 0; PaintIndex < PaintEntries.Num(); PaintIndex++)
+    {
+        if (!EnumHasAnyFlags(PaintFlags[PaintIndex], EHUDProjectionFlags::InFront))
+        {
+            continue;
+        }
+
+        const FDamageNumberEntry& Entry = Entries[PaintEntries[PaintIndex]];
+        const FVector2f ScreenLocation = PaintPositions[PaintIndex];
+
+        const float Alpha = FMath::Clamp(static_cast<float>((Entry.ExpireTime - Now) / FadeTime), 0.0f, 1.0f);
+        FLinearColor Color = Entry.Color;
+        Color.A = Alpha;
+
+        const FSlateFontInfo& Font = Fonts[Entry.FontIndex];
+
+        // Shadows on one layer and numbers on the next, so all of them batch together
+        FSlateDrawElement::MakeText(
+            OutDrawElements,
+            LayerId,
+            AllottedGeometry.ToPaintGeometry(FVector2f(1, 1), FSlateLayoutTransform(FVector2f(ScreenLocation.X + 2, ScreenLocation.Y + 2))),
+            Entry.Text,
+            Font,
+            ESlateDrawEffect::None,
+            FLinearColor(0, 0, 0, Alpha)
+        );
+
+        FSlateDrawElement::MakeText(
+            OutDrawElements,
+            LayerId + 1,
+            AllottedGeometry.ToPaintGeometry(FVector2f(1, 1), FSlateLayoutTransform(FVector2f(ScreenLocation.X, ScreenLocation.Y))),
+            Entry.Text,
+            Font,
+            ESlateDrawEffect::None,
+            Color
+        );
+
+        NumPainted++;
+    }
+
+    TRINITYFLOW_INC_COUNTER(DamageNumbersPainted, NumPainted);
+    return LayerId + 2;
+}
+
+#undef LOCTEXT_NAMESPACE
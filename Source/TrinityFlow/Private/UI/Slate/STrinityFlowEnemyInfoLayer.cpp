@@ -0,0 +1,406 @@
+#include "UI/Slate/STrinityFlowEnemyInfoLayer.h"
+#include "UI/Slate/STrinityFlowEnemyInfoPanel.h"
+#include "UI/TrinityFlowHUDProjection.h"
+#include "Core/HealthComponent.h"
+#include "Core/TrinityFlowProfiling.h"
+#include "Enemy/EnemyBase.h"
+#include "Widgets/SOverlay.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarMaxEnemyPanels(
+    TEXT("TrinityFlow.UI.MaxEnemyPanels"),
+    8,
+    TEXT("Maximum number of enemy info panels shown at once; the most relevant enemies get them"));
+
+static TAutoConsoleVariable<float> CVarEnemyPanelRange(
+    TEXT("TrinityFlow.UI.EnemyPanelRange"),
+    3000.0f,
+    TEXT("Enemies further than this from the player only get a panel while fighting or recently hit"));
+
+static TAutoConsoleVariable<float> CVarEnemyPanelThrottleDistance(
+    TEXT("TrinityFlow.UI.EnemyPanelThrottleDistance"),
+    1500.0f,
+    TEXT("Panels of enemies beyond this distance update their screen position every few frames"));
+
+namespace EnemyInfoLayer
+{
+    // Relevance is re-ranked at this rate rather than every frame
+    static constexpr float SelectionInterval = 0.25f;
+
+    static constexpr uint32 DistantUpdateInterval = 3;
+    static constexpr double RecentHitWindow = 3.0;
+}
+
+void STrinityFlowEnemyInfoLayer::Construct(const FArguments& InArgs)
+{
+    Projection = InArgs._Projection;
+
+    ChildSlot
+    [
+        SAssignNew(PanelOverlay, SOverlay)
+    ];
+}
+
+STrinityFlowEnemyInfoLayer::~STrinityFlowEnemyInfoLayer()
+{
+    for (FTrackedEnemy& Tracked : TrackedEnemies)
+    {
+        if (UHealthComponent* Health = Tracked.Health.Get())
+        {
+            Health->OnResourcesChangedNative.Remove(Tracked.ResourcesChangedHandle);
+        }
+    }
+}
+
+void STrinityFlowEnemyInfoLayer::AddEnemy(AEnemyBase* Enemy)
+{
+    if (!Enemy || TrackedIndices.Contains(Enemy))
+    {
+        return;
+    }
+
+    const int32 Index = TrackedEnemies.AddDefaulted();
+    FTrackedEnemy& Tracked = TrackedEnemies[Index];
+    Tracked.Key = Enemy;
+    Tracked.Enemy = Enemy;
+
+    // Panel text follows the health component's change events instead of being rebuilt per frame
+    if (UHealthComponent* Health = Enemy->FindComponentByClass<UHealthComponent>())
+    {
+        Tracked.Health = Health;
+        Tracked.ResourcesChangedHandle = Health->OnResourcesChangedNative.AddSP(
+            this, &STrinityFlowEnemyInfoLayer::OnResourcesChanged, Tracked.Key);
+    }
+
+    TrackedIndices.Add(Tracked.Key, Index);
+    bSelectionDirty = true;
+}
+
+void STrinityFlowEnemyInfoLayer::RemoveEnemy(AEnemyBase* Enemy)
+{
+    if (const int32* Index = TrackedIndices.Find(Enemy))
+    {
+        RemoveTrackedAt(*Index);
+    }
+}
+
+void STrinityFlowEnemyInfoLayer::RemoveTrackedAt(int32 Index)
+{
+    FTrackedEnemy& Tracked = TrackedEnemies[Index];
+    ReleasePanel(Tracked);
+
+    if (UHealthComponent* Health = Tracked.Health.Get())
+    {
+        Health->OnResourcesChangedNative.Remove(Tracked.ResourcesChangedHandle);
+    }
+
+    TrackedIndices.Remove(Tracked.Key);
+    TrackedEnemies.RemoveAtSwap(Index, EAllowShrinking::No);
+    if (TrackedEnemies.IsValidIndex(Index))
+    {
+        TrackedIndices[TrackedEnemies[Index].Key] = Index;
+    }
+}
+
+void STrinityFlowEnemyInfoLayer::OnResourcesChanged(const UHealthComponent* Health, TObjectKey<AEnemyBase> EnemyKey)
+{
+    const int32* Index = TrackedIndices.Find(EnemyKey);
+    if (!Index)
+    {
+        return;
+    }
+
+    FTrackedEnemy& Tracked = TrackedEnemies[*Index];
+    Tracked.LastChangeTime = FPlatformTime::Seconds();
+
+    if (Tracked.PanelIndex != INDEX_NONE)
+    {
+        PanelSlots[Tracked.PanelIndex].bStatsDirty = true;
+    }
+}
+
+void STrinityFlowEnemyInfoLayer::ShowTimingBar(AEnemyBase* Enemy, float Duration, float PerfectStart, float PerfectEnd)
+{
+    const int32* Index = Enemy ? TrackedIndices.Find(Enemy) : nullptr;
+    if (!Index)
+    {
+        return;
+    }
+
+    FTrackedEnemy& Tracked = TrackedEnemies[*Index];
+    Tracked.bTimingActive = true;
+
+    // Make sure the defender has a panel right away rather than at the next re-rank
+    if (Tracked.PanelIndex == INDEX_NONE)
+    {
+        UWorld* World = Enemy->GetWorld();
+        ScoreRelevance(World);
+        SelectPanels(World);
+    }
+
+    if (Tracked.PanelIndex != INDEX_NONE)
+    {
+        PanelSlots[Tracked.PanelIndex].Panel->ShowTimingBar(Duration, PerfectStart, PerfectEnd);
+    }
+}
+
+void STrinityFlowEnemyInfoLayer::HideTimingBar(AEnemyBase* Enemy)
+{
+    const int32* Index = Enemy ? TrackedIndices.Find(Enemy) : nullptr;
+    if (!Index)
+    {
+        return;
+    }
+
+    FTrackedEnemy& Tracked = TrackedEnemies[*Index];
+    Tracked.bTimingActive = false;
+
+    if (Tracked.PanelIndex != INDEX_NONE)
+    {
+        PanelSlots[Tracked.PanelIndex].Panel->HideTimingBar();
+    }
+}
+
+int32 STrinityFlowEnemyInfoLayer::GetNumShown() const
+{
+    int32 NumShown = 0;
+    for (const FPanelSlot& Slot : PanelSlots)
+    {
+        NumShown += Slot.bInUse ? 1 : 0;
+    }
+    return NumShown;
+}
+
+void STrinityFlowEnemyInfoLayer::ScoreRelevance(UWorld* World)
+{
+    APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+    if (!PC)
+    {
+        return;
+    }
+
+    FVector ViewLocation;
+    FRotator ViewRotation;
+    PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+    const FVector ViewForward = ViewRotation.Vector();
+
+    const APawn* PlayerPawn = PC->GetPawn();
+    const FVector PlayerLocation = PlayerPawn ? PlayerPawn->GetActorLocation() : ViewLocation;
+
+    const float Range = FMath::Max(CVarEnemyPanelRange.GetValueOnGameThread(), 1.0f);
+    const double Now = FPlatformTime::Seconds();
+
+    for (FTrackedEnemy& Tracked : TrackedEnemies)
+    {
+        const AEnemyBase* Enemy = Tracked.Enemy.Get();
+        const UHealthComponent* Health = Tracked.Health.Get();
+        if (!Enemy || (Health && !Health->IsAlive()))
+        {
+            Tracked.Relevance = -1.0f;
+            continue;
+        }
+
+        const FVector EnemyLocation = Enemy->GetActorLocation();
+        Tracked.Distance = FVector::Dist(EnemyLocation, PlayerLocation);
+
+        const bool bInCombat = Enemy->GetTargetPlayer() != nullptr;
+        const bool bRecentlyHit = Now - Tracked.LastChangeTime < EnemyInfoLayer::RecentHitWindow;
+        if (!Tracked.bTimingActive && !bInCombat && !bRecentlyHit && Tracked.Distance > Range)
+        {
+            Tracked.Relevance = -1.0f;
+            continue;
+        }
+
+        float Relevance = FMath::Max(0.0f, 1.0f - Tracked.Distance / Range);
+        if (FVector::DotProduct((EnemyLocation - ViewLocation).GetSafeNormal(), ViewForward) > 0.5f)
+        {
+            Relevance += 1.0f;
+        }
+        if (bInCombat)
+        {
+            Relevance += 2.0f;
+        }
+        if (bRecentlyHit)
+        {
+            Relevance += 3.0f;
+        }
+        if (Tracked.bTimingActive)
+        {
+            Relevance += 100.0f;
+        }
+        Tracked.Relevance = Relevance;
+    }
+}
+
+void STrinityFlowEnemyInfoLayer::SelectPanels(UWorld* World)
+{
+    bSelectionDirty = false;
+    TimeSinceSelection = 0.0f;
+
+    RankedIndices.Reset();
+    for (int32 Index = 0; Index < TrackedEnemies.Num(); Index++)
+    {
+        if (TrackedEnemies[Index].Relevance >= 0.0f)
+        {
+            RankedIndices.Add(Index);
+        }
+    }
+
+    const int32 MaxPanels = FMath::Max(CVarMaxEnemyPanels.GetValueOnGameThread(), 0);
+    if (RankedIndices.Num() > MaxPanels)
+    {
+        RankedIndices.Sort([this](int32 A, int32 B)
+        {
+            return TrackedEnemies[A].Relevance > TrackedEnemies[B].Relevance;
+        });
+        RankedIndices.SetNum(MaxPanels, EAllowShrinking::No);
+    }
+
+    // Free panels first so newly relevant enemies can take them
+    for (int32 Index = 0; Index < TrackedEnemies.Num(); Index++)
+    {
+        if (TrackedEnemies[Index].PanelIndex != INDEX_NONE && !RankedIndices.Contains(Index))
+        {
+            ReleasePanel(TrackedEnemies[Index]);
+        }
+    }
+
+    const float ThrottleDistance = CVarEnemyPanelThrottleDistance.GetValueOnGameThread();
+    for (int32 Index : RankedIndices)
+    {
+        FTrackedEnemy& Tracked = TrackedEnemies[Index];
+        if (Tracked.PanelIndex == INDEX_NONE && AcquirePanel(Tracked) == INDEX_NONE)
+        {
+            continue;
+        }
+        PanelSlots[Tracked.PanelIndex].bDistant = Tracked.Distance > ThrottleDistance;
+    }
+}
+
+int32 STrinityFlowEnemyInfoLayer::AcquirePanel(FTrackedEnemy& Tracked)
+{
+    int32 SlotIndex = PanelSlots.IndexOfByPredicate([](const FPanelSlot& Slot) { return !Slot.bInUse; });
+
+    if (SlotIndex == INDEX_NONE)
+    {
+        if (PanelSlots.Num() >= CVarMaxEnemyPanels.GetValueOnGameThread())
+        {
+            return INDEX_NONE;
+        }
+
+        // Panels are created on demand and then kept for reuse
+        SlotIndex = PanelSlots.AddDefaulted();
+        SAssignNew(PanelSlots[SlotIndex].Panel, STrinityFlowEnemyInfoPanel);
+        PanelOverlay->AddSlot()
+        .HAlign(HAlign_Left)
+        .VAlign(VAlign_Top)
+        [
+            PanelSlots[SlotIndex].Panel.ToSharedRef()
+        ];
+    }
+
+    FPanelSlot& Slot = PanelSlots[SlotIndex];
+    Slot.Enemy = Tracked.Enemy;
+    Slot.bInUse = true;
+    Slot.bStatsDirty = false;
+    Slot.bNeedsPosition = true;
+    Slot.ShownPosition = FVector2f(-1.0f, -1.0f);
+    Slot.AnchorHandle = Projection.IsValid() ? Projection->AddAnchor(Tracked.Enemy.Get(), FVector(0, 0, 100)) : INDEX_NONE;
+    Slot.Panel->SetEnemy(Tracked.Enemy.Get());
+    Slot.Panel->SetVisibility(EVisibility::Hidden);
+
+    Tracked.PanelIndex = SlotIndex;
+    return SlotIndex;
+}
+
+void STrinityFlowEnemyInfoLayer::ReleasePanel(FTrackedEnemy& Tracked)
+{
+    if (Tracked.PanelIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    FPanelSlot& Slot = PanelSlots[Tracked.PanelIndex];
+    Slot.Enemy = nullptr;
+    Slot.bInUse = false;
+    if (Projection.IsValid())
+    {
+        Projection->RemoveAnchor(Slot.AnchorHandle);
+    }
+    Slot.AnchorHandle = INDEX_NONE;
+    Slot.Panel->SetEnemy(nullptr);
+    Slot.Panel->SetVisibility(EVisibility::Collapsed);
+
+    Tracked.PanelIndex = INDEX_NONE;
+}
+
+void STrinityFlowEnemyInfoLayer::Update(UWorld* World, float DeltaTime)
+{
+    TRINITYFLOW_SCOPE_CYCLE_COUNTER(EnemyInfoPanels);
+
+    if (!World)
+    {
+        return;
+    }
+
+    FrameCounter++;
+    TimeSinceSelection += DeltaTime;
+    if (bSelectionDirty || TimeSinceSelection >= EnemyInfoLayer::SelectionInterval)
+    {
+        ScoreRelevance(World);
+        SelectPanels(World);
+    }
+
+    if (!Projection.IsValid() || !Projection->HasView())
+    {
+        return;
+    }
+
+    for (int32 SlotIndex = 0; SlotIndex < PanelSlots.Num(); SlotIndex++)
+    {
+        FPanelSlot& Slot = PanelSlots[SlotIndex];
+        if (!Slot.bInUse)
+        {
+            continue;
+        }
+
+        if (!Slot.Enemy.IsValid())
+        {
+            Slot.Panel->SetVisibility(EVisibility::Collapsed);
+            continue;
+        }
+
+        if (Slot.bStatsDirty)
+        {
+            Slot.Panel->RefreshStats();
+            Slot.bStatsDirty = false;
+        }
+
+        // Distant panels move on staggered frames
+        if (Slot.bDistant && !Slot.bNeedsPosition && (FrameCounter + SlotIndex) % EnemyInfoLayer::DistantUpdateInterval != 0)
+        {
+            continue;
+        }
+        Slot.bNeedsPosition = false;
+
+        if (EnumHasAnyFlags(Projection->GetAnchorFlags(Slot.AnchorHandle), EHUDProjectionFlags::InFront))
+        {
+            Slot.Panel->SetVisibility(EVisibility::Visible);
+
+            // Sub-pixel camera motion would otherwise invalidate every panel every frame
+            const FVector2f Position = Projection->GetAnchorPosition(Slot.AnchorHandle).RoundToVector();
+            if (Position != Slot.ShownPosition)
+            {
+                Slot.ShownPosition = Position;
+                Slot.Panel->SetRenderTransform(FSlateRenderTransform(FVector2D(Position)));
+            }
+        }
+        else
+        {
+            Slot.Panel->SetVisibility(EVisibility::Hidden);
+        }
+    }
+}
@@ -1,6 +1,7 @@
 #include "UI/Slate/STrinityFlowEnemyInfoPanel.h"
 #include "Enemy/EnemyBase.h"
 #include "Core/HealthComponent.h"
+#include "Core/CombatantHandleSubsystem.h"
 #include "UI/TrinityFlowStyle.h"
 #include "UI/Slate/STrinityFlowDefenseTimingBar.h"
 #include "Widgets/SBoxPanel.h"
@@ -11,7 +12,6 @@
 
 void STrinityFlowEnemyInfoPanel::Construct(const FArguments& InArgs)
 {
-    TargetEnemy = InArgs._Enemy;
     const ISlateStyle* Style = &FTrinityFlowStyle::Get();
 
     ChildSlot
@@ -68,19 +68,33 @@ void STrinityFlowEnemyInfoPanel::Construct(const FArguments& InArgs)
         ]
     ];
 
-    Update();
+    SetEnemy(InArgs._Enemy);
 }
 
-void STrinityFlowEnemyInfoPanel::Update()
+void STrinityFlowEnemyInfoPanel::SetEnemy(AEnemyBase* Enemy)
 {
-    if (!TargetEnemy)
+    TargetEnemy = Enemy;
+    ShownAttack = -1.0f;
+    ShownDefence = -1.0f;
+
+    HideTimingBar();
+
+    if (Enemy)
     {
-        return;
+        NameText->SetText(FText::FromString(Enemy->GetName()));
+        RefreshStats();
     }
+}
 
-    NameText->SetText(FText::FromString(TargetEnemy->GetName()));
+void STrinityFlowEnemyInfoPanel::RefreshStats()
+{
+    AEnemyBase* Enemy = TargetEnemy.Get();
+    if (!Enemy)
+    {
+        return;
+    }
 
-    if (UHealthComponent* HealthComp = TargetEnemy->FindComponentByClass<UHealthComponent>())
+    if (UHealthComponent* HealthComp = UCombatantHandleSubsystem::Get(Enemy).Health.Get())
     {
         float HealthPercent = HealthComp->GetHealthPercentage();
         HealthBar->SetPercent(HealthPercent);
@@ -96,7 +110,12 @@ void STrinityFlowEnemyInfoPanel::Update()
         }
         
         const FCharacterResources& Resources = HealthComp->GetResources();
-        StatsText->SetText(FText::Format(FText::FromString("ATK: {0} | DEF: {1}"), FText::AsNumber(Resources.AttackPoint), FText::AsNumber(Resources.DefencePoint)));
+        if (Resources.AttackPoint != ShownAttack || Resources.DefencePoint != ShownDefence)
+        {
+            ShownAttack = Resources.AttackPoint;
+            ShownDefence = Resources.DefencePoint;
+            StatsText->SetText(FText::Format(FText::FromString("ATK: {0} | DEF: {1}"), FText::AsNumber(Resources.AttackPoint), FText::AsNumber(Resources.DefencePoint)));
+        }
     }
 }
 
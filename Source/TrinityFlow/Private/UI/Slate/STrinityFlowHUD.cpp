@@ -1,29 +1,48 @@
 #include "UI/Slate/STrinityFlowHUD.h"
+#include "Core/TrinityFlowProfiling.h"
 #include "UI/TrinityFlowUIManager.h"
 #include "UI/TrinityFlowStyle.h"
+#include "UI/TrinityFlowHUDProjection.h"
+#include "UI/TrinityFlowHUDViewModel.h"
 #include "UI/Slate/STrinityFlowHealthBar.h"
 #include "UI/Slate/STrinityFlowWeaponPanel.h"
-#include "UI/Slate/STrinityFlowDamageNumber.h"
-#include "UI/Slate/STrinityFlowEnemyInfoPanel.h"
+#include "UI/Slate/STrinityFlowDamageNumberLayer.h"
+#include "UI/Slate/STrinityFlowEnemyInfoLayer.h"
 #include "UI/Slate/STrinityFlowDefenseTimingBar.h"
 #include "UI/Slate/STrinityFlowStanceBar.h"
 #include "Widgets/SBoxPanel.h"
 #include "Widgets/SOverlay.h"
+#include "Widgets/SInvalidationPanel.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/Layout/SSpacer.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Images/SImage.h"
 #include "Engine/World.h"
-#include "GameFramework/PlayerController.h"
 #include "Enemy/EnemyBase.h"
-#include "Core/StanceComponent.h"
+#include "Core/CombatReplaySubsystem.h"
+#include "Debugging/SlateDebugging.h"
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
 
 #define LOCTEXT_NAMESPACE "TrinityFlowHUD"
 
+static TAutoConsoleVariable<bool> CVarCacheStaticHUD(
+    TEXT("TrinityFlow.UI.CacheStaticHUD"),
+    true,
+    TEXT("Cache the static HUD sections in invalidation panels instead of laying them out and painting them every frame"));
+
+#if !UE_BUILD_SHIPPING
+static TAutoConsoleVariable<bool> CVarHUDWidgetStats(
+    TEXT("TrinityFlow.UI.WidgetStats"),
+    false,
+    TEXT("Show the number of HUD widgets and how many of them were invalidated last frame (also in stat TrinityFlow)"));
+#endif
+
 void STrinityFlowHUD::Construct(const FArguments& InArgs)
 {
     UIManager = InArgs._UIManager;
+    Projection = MakeShared<FTrinityFlowHUDProjection>();
     const ISlateStyle* Style = &FTrinityFlowStyle::Get();
 
     ChildSlot
@@ -35,7 +54,8 @@ void STrinityFlowHUD::Construct(const FArguments& InArgs)
         .HAlign(HAlign_Fill)
         .VAlign(VAlign_Fill)
         [
-            SAssignNew(EnemyInfoOverlay, SOverlay)
+            SAssignNew(EnemyInfoLayer, STrinityFlowEnemyInfoLayer)
+            .Projection(Projection)
         ]
 
         // Damage Numbers Layer
@@ -43,68 +63,156 @@ void STrinityFlowHUD::Construct(const FArguments& InArgs)
         .HAlign(HAlign_Fill)
         .VAlign(VAlign_Fill)
         [
-            SAssignNew(DamageNumberOverlay, SOverlay)
+            SAssignNew(DamageNumberLayer, STrinityFlowDamageNumberLayer)
+            .Projection(Projection)
         ]
         
-        // Health Bar (Bottom Left)
+        // Static HUD (health, weapons, combat state, stats), repainted only when one of them changes
         + SOverlay::Slot()
-        .HAlign(HAlign_Left)
-        .VAlign(VAlign_Bottom)
-        .Padding(20, 0, 0, 100)
+        .HAlign(HAlign_Fill)
+        .VAlign(VAlign_Fill)
         [
-            SNew(SBox)
-            .WidthOverride(300)
-            .HeightOverride(30)
+            SAssignNew(StaticPanel, SInvalidationPanel)
+            .DebugName(TEXT("TrinityFlowHUD.Static"))
             [
-                SAssignNew(HealthBar, STrinityFlowHealthBar)
-            ]
-        ]
+                SNew(SOverlay)
+
+                // Health Bar (Bottom Left)
+                + SOverlay::Slot()
+                .HAlign(HAlign_Left)
+                .VAlign(VAlign_Bottom)
+                .Padding(20, 0, 0, 100)
+                [
+                    SNew(SBox)
+                    .WidthOverride(300)
+                    .HeightOverride(30)
+                    [
+                        SAssignNew(HealthBar, STrinityFlowHealthBar)
+                    ]
+                ]
         
-        // Weapon Panels (Bottom Center)
-        + SOverlay::Slot()
-        .HAlign(HAlign_Center)
-        .VAlign(VAlign_Bottom)
-        .Padding(0, 0, 0, 50)
-        [
-            SNew(SHorizontalBox)
-            // Left Weapon (Soul)
-            + SHorizontalBox::Slot()
-            .AutoWidth()
-            .Padding(10, 0)
-            [
-                SAssignNew(LeftWeaponPanel, STrinityFlowWeaponPanel)
-                .WeaponName(FText::FromString("Override Katana"))
-                .WeaponColor(Style->GetColor("TrinityFlow.Color.Soul"))
-                .AbilityKey1(FText::FromString("Q"))
-                .AbilityKey2(FText::FromString("Tab"))
-            ]
+                // Weapon Panels (Bottom Center)
+                + SOverlay::Slot()
+                .HAlign(HAlign_Center)
+                .VAlign(VAlign_Bottom)
+                .Padding(0, 0, 0, 50)
+                [
+                    SNew(SHorizontalBox)
+                    // Left Weapon (Soul)
+                    + SHorizontalBox::Slot()
+                    .AutoWidth()
+                    .Padding(10, 0)
+                    [
+                        SAssignNew(LeftWeaponPanel, STrinityFlowWeaponPanel)
+                        .WeaponName(FText::FromString("Override Katana"))
+                        .WeaponColor(Style->GetColor("TrinityFlow.Color.Soul"))
+                        .AbilityKey1(FText::FromString("Q"))
+                        .AbilityKey2(FText::FromString("Tab"))
+                    ]
             
-            // Separator
-            + SHorizontalBox::Slot()
-            .AutoWidth()
-            [
-                SNew(SBox)
-                .WidthOverride(2)
-                .HeightOverride(80)
+                    // Separator
+                    + SHorizontalBox::Slot()
+                    .AutoWidth()
+                    [
+                        SNew(SBox)
+                        .WidthOverride(2)
+                        .HeightOverride(80)
+                        [
+                            SNew(SBorder)
+                            .BorderImage(Style->GetBrush("TrinityFlow.Brush.Separator"))
+                        ]
+                    ]
+            
+                    // Right Weapon (Physical)
+                    + SHorizontalBox::Slot()
+                    .AutoWidth()
+                    .Padding(10, 0)
+                    [
+                        SAssignNew(RightWeaponPanel, STrinityFlowWeaponPanel)
+                        .WeaponName(FText::FromString("Physical Katana"))
+                        .WeaponColor(Style->GetColor("TrinityFlow.Color.Power"))
+                        .AbilityKey1(FText::FromString("E"))
+                        .AbilityKey2(FText::FromString("R"))
+                    ]
+                ]
+
+                // Combat State (Top Center)
+                + SOverlay::Slot()
+                .HAlign(HAlign_Center)
+                .VAlign(VAlign_Top)
+                .Padding(0, 50, 0, 0)
                 [
                     SNew(SBorder)
-                    .BorderImage(Style->GetBrush("TrinityFlow.Brush.Separator"))
+                    .BorderImage(Style->GetBrush("TrinityFlow.Brush.ToolPanel"))
+                    .Padding(20, 10)
+                    [
+                        SAssignNew(CombatStateText, STextBlock)
+                        .Text(LOCTEXT("NonCombat", "NON-COMBAT"))
+                        .TextStyle(&Style->GetWidgetStyle<FTextBlockStyle>("TrinityFlow.Font.Bold"))
+                        .ColorAndOpacity(Style->GetColor("TrinityFlow.Color.Positive"))
+                        .ShadowOffset(FVector2D(1, 1))
+                        .ShadowColorAndOpacity(FLinearColor::Black)
+                    ]
+                ]
+        
+                // Player Stats (Bottom Left, above health)
+                + SOverlay::Slot()
+                .HAlign(HAlign_Left)
+                .VAlign(VAlign_Bottom)
+                .Padding(20, 0, 0, 140)
+                [
+                    SNew(SBorder)
+                    .BorderImage(Style->GetBrush("TrinityFlow.Brush.ToolPanel"))
+                    .Padding(15)
+                    [
+                        SAssignNew(PlayerStatsBox, SVerticalBox)
+                        // Stance
+                        + SVerticalBox::Slot()
+                        .AutoHeight()
+                        [
+                            SAssignNew(StanceText, STextBlock)
+                            .Text(LOCTEXT("BalancedStance", "Stance: Balanced"))
+                            .TextStyle(&Style->GetWidgetStyle<FTextBlockStyle>("TrinityFlow.Font.Regular"))
+                            .ColorAndOpacity(Style->GetColor("TrinityFlow.Color.Balanced"))
+                        ]
+                
+                        // Active Shards
+                        + SVerticalBox::Slot()
+                        .AutoHeight()
+                        .Padding(0, 5, 0, 0)
+                        [
+                            SAssignNew(ShardsText, STextBlock)
+                            .Text(LOCTEXT("ActiveShards", "Active: 0 Soul / 0 Power"))
+                            .TextStyle(&Style->GetWidgetStyle<FTextBlockStyle>("TrinityFlow.Font.Regular"))
+                            .ColorAndOpacity(Style->GetColor("TrinityFlow.Color.Neutral"))
+                        ]
+                
+                        // Inactive Shards
+                        + SVerticalBox::Slot()
+                        .AutoHeight()
+                        .Padding(0, 2, 0, 0)
+                        [
+                            SAssignNew(InactiveShardsText, STextBlock)
+                            .Text(LOCTEXT("InactiveShards", "Inactive: 0 Soul / 0 Power"))
+                            .TextStyle(&Style->GetWidgetStyle<FTextBlockStyle>("TrinityFlow.Font.Regular"))
+                            .ColorAndOpacity(FSlateColor(FLinearColor(0.6f, 0.6f, 0.6f)))
+                        ]
+                
+                        // Damage Bonuses
+                        + SVerticalBox::Slot()
+                        .AutoHeight()
+                        .Padding(0, 5, 0, 0)
+                        [
+                            SAssignNew(DamageBonusText, STextBlock)
+                            .Text(LOCTEXT("DamageBonus", "Damage: +0% Soul / +0% Physical"))
+                            .TextStyle(&Style->GetWidgetStyle<FTextBlockStyle>("TrinityFlow.Font.Regular"))
+                            .ColorAndOpacity(FLinearColor::Yellow)
+                        ]
+                    ]
                 ]
-            ]
-            
-            // Right Weapon (Physical)
-            + SHorizontalBox::Slot()
-            .AutoWidth()
-            .Padding(10, 0)
-            [
-                SAssignNew(RightWeaponPanel, STrinityFlowWeaponPanel)
-                .WeaponName(FText::FromString("Physical Katana"))
-                .WeaponColor(Style->GetColor("TrinityFlow.Color.Power"))
-                .AbilityKey1(FText::FromString("E"))
-                .AbilityKey2(FText::FromString("R"))
             ]
         ]
-        
+
         // Stance Flow Bar (Bottom Center, above weapon panels)
         + SOverlay::Slot()
         .HAlign(HAlign_Center)
@@ -114,81 +222,6 @@ void STrinityFlowHUD::Construct(const FArguments& InArgs)
             SAssignNew(StanceBar, STrinityFlowStanceBar)
         ]
         
-        // Combat State (Top Center)
-        + SOverlay::Slot()
-        .HAlign(HAlign_Center)
-        .VAlign(VAlign_Top)
-        .Padding(0, 50, 0, 0)
-        [
-            SNew(SBorder)
-            .BorderImage(Style->GetBrush("TrinityFlow.Brush.ToolPanel"))
-            .Padding(20, 10)
-            [
-                SAssignNew(CombatStateText, STextBlock)
-                .Text(LOCTEXT("NonCombat", "NON-COMBAT"))
-                .TextStyle(&Style->GetWidgetStyle<FTextBlockStyle>("TrinityFlow.Font.Bold"))
-                .ColorAndOpacity(Style->GetColor("TrinityFlow.Color.Positive"))
-                .ShadowOffset(FVector2D(1, 1))
-                .ShadowColorAndOpacity(FLinearColor::Black)
-            ]
-        ]
-        
-        // Player Stats (Bottom Left, above health)
-        + SOverlay::Slot()
-        .HAlign(HAlign_Left)
-        .VAlign(VAlign_Bottom)
-        .Padding(20, 0, 0, 140)
-        [
-            SNew(SBorder)
-            .BorderImage(Style->GetBrush("TrinityFlow.Brush.ToolPanel"))
-            .Padding(15)
-            [
-                SAssignNew(PlayerStatsBox, SVerticalBox)
-                // Stance
-                + SVerticalBox::Slot()
-                .AutoHeight()
-                [
-                    SAssignNew(StanceText, STextBlock)
-                    .Text(LOCTEXT("BalancedStance", "Stance: Balanced"))
-                    .TextStyle(&Style->GetWidgetStyle<FTextBlockStyle>("TrinityFlow.Font.Regular"))
-                    .ColorAndOpacity(Style->GetColor("TrinityFlow.Color.Balanced"))
-                ]
-                
-                // Active Shards
-                + SVerticalBox::Slot()
-                .AutoHeight()
-                .Padding(0, 5, 0, 0)
-                [
-                    SAssignNew(ShardsText, STextBlock)
-                    .Text(LOCTEXT("ActiveShards", "Active: 0 Soul / 0 Power"))
-                    .TextStyle(&Style->GetWidgetStyle<FTextBlockStyle>("TrinityFlow.Font.Regular"))
-                    .ColorAndOpacity(Style->GetColor("TrinityFlow.Color.Neutral"))
-                ]
-                
-                // Inactive Shards
-                + SVerticalBox::Slot()
-                .AutoHeight()
-                .Padding(0, 2, 0, 0)
-                [
-                    SAssignNew(InactiveShardsText, STextBlock)
-                    .Text(LOCTEXT("InactiveShards", "Inactive: 0 Soul / 0 Power"))
-                    .TextStyle(&Style->GetWidgetStyle<FTextBlockStyle>("TrinityFlow.Font.Regular"))
-                    .ColorAndOpacity(FSlateColor(FLinearColor(0.6f, 0.6f, 0.6f)))
-                ]
-                
-                // Damage Bonuses
-                + SVerticalBox::Slot()
-                .AutoHeight()
-                .Padding(0, 5, 0, 0)
-                [
-                    SAssignNew(DamageBonusText, STextBlock)
-                    .Text(LOCTEXT("DamageBonus", "Damage: +0% Soul / +0% Physical"))
-                    .TextStyle(&Style->GetWidgetStyle<FTextBlockStyle>("TrinityFlow.Font.Regular"))
-                    .ColorAndOpacity(FLinearColor::Yellow)
-                ]
-            ]
-        ]
-        
         // Defense Timing Bar (Center)
         + SOverlay::Slot()
         .HAlign(HAlign_Center)
@@ -202,273 +235,282 @@ void STrinityFlowHUD::Construct(const FArguments& InArgs)
         .HAlign(HAlign_Center)
         .VAlign(VAlign_Center)
         [
-            SNew(SBox)
-            .WidthOverride(10)
-            .HeightOverride(10)
+            SAssignNew(CrosshairPanel, SInvalidationPanel)
+            .DebugName(TEXT("TrinityFlowHUD.Crosshair"))
             [
-                SNew(SBorder)
-                .BorderImage(Style->GetBrush("TrinityFlow.Brush.White"))
+                SNew(SBox)
+                .WidthOverride(10)
+                .HeightOverride(10)
+                [
+                    SNew(SBorder)
+                    .BorderImage(Style->GetBrush("TrinityFlow.Brush.White"))
+                ]
             ]
         ]
     ];
-}
 
-void STrinityFlowHUD::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
-{
-    SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
-    
-    UpdateEnemyInfoPanels(AllottedGeometry);
-
-    // Update damage numbers
-    for (int32 i = DamageNumbers.Num() - 1; i >= 0; i--)
+    // Enemies registered before the HUD was created
+    if (UIManager)
     {
-        if (DamageNumbers[i].IsValid())
+        for (AEnemyBase* Enemy : UIManager->GetRegisteredEnemies())
         {
-            if (DamageNumbers[i]->IsExpired())
-            {
-                DamageNumberOverlay->RemoveSlot(DamageNumbers[i].ToSharedRef());
-                DamageNumbers.RemoveAt(i);
-            }
+            EnemyInfoLayer->AddEnemy(Enemy);
         }
     }
 }
 
-void STrinityFlowHUD::UpdatePlayerHealth(float HealthPercentage)
+STrinityFlowHUD::~STrinityFlowHUD()
 {
-    if (HealthBar.IsValid())
-    {
-        HealthBar->SetHealthPercentage(HealthPercentage);
-    }
+#if !UE_BUILD_SHIPPING && WITH_SLATE_DEBUGGING
+    FSlateDebugging::WidgetInvalidateEvent.Remove(WidgetInvalidatedHandle);
+#endif
 }
 
-void STrinityFlowHUD::UpdateWeaponCooldowns(float QCooldown, float TabCooldown, float ECooldown, float RCooldown)
+void STrinityFlowHUD::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
 {
-    if (LeftWeaponPanel.IsValid())
+    TRINITYFLOW_SCOPE_CYCLE_COUNTER(HUDTick);
+
+    SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+    const bool bCacheStatic = CVarCacheStaticHUD.GetValueOnGameThread();
+    if (bCacheStatic != bCachingStaticPanels)
     {
-        LeftWeaponPanel->SetCooldowns(QCooldown, TabCooldown);
+        bCachingStaticPanels = bCacheStatic;
+        StaticPanel->SetCanCache(bCacheStatic);
+        CrosshairPanel->SetCanCache(bCacheStatic);
     }
     
-    if (RightWeaponPanel.IsValid())
+    if (UIManager)
     {
-        RightWeaponPanel->SetCooldowns(ECooldown, RCooldown);
+        SyncViewModel(UIManager->GetHUDViewModel());
+        Projection->Update(UIManager->GetWorld());
+        EnemyInfoLayer->Update(UIManager->GetWorld(), InDeltaTime);
     }
+
+#if !UE_BUILD_SHIPPING
+    UpdateWidgetStats();
+#endif
 }
 
-void STrinityFlowHUD::UpdatePlayerStats(int32 SoulActive, int32 PowerActive, int32 SoulInactive, int32 PowerInactive, float SoulBonus, float PhysicalBonus)
+#if !UE_BUILD_SHIPPING
+void STrinityFlowHUD::UpdateWidgetStats()
 {
-    // Get actual stance from player's StanceComponent
-    FText StanceTextValue = LOCTEXT("BalancedStance", "Stance: Balanced");
-    FLinearColor StanceColor = FLinearColor(0.8f, 0.2f, 1.0f);
-    
-    if (UIManager)
+    if (!CVarHUDWidgetStats.GetValueOnGameThread())
     {
-        if (APawn* PlayerPawn = UIManager->GetWorld()->GetFirstPlayerController()->GetPawn())
+        if (WidgetInvalidatedHandle.IsValid())
         {
-            if (UStanceComponent* StanceComp = PlayerPawn->FindComponentByClass<UStanceComponent>())
-            {
-                EStanceType CurrentStance = StanceComp->GetCurrentStance();
-                
-                switch (CurrentStance)
-                {
-                    case EStanceType::Soul:
-                        StanceTextValue = LOCTEXT("SoulStance", "Stance: Soul");
-                        StanceColor = FLinearColor(0.0f, 0.5f, 1.0f);
-                        break;
-                    case EStanceType::Power:
-                        StanceTextValue = LOCTEXT("PowerStance", "Stance: Power");
-                        StanceColor = FLinearColor(1.0f, 0.5f, 0.0f);
-                        break;
-                    case EStanceType::Balanced:
-                    default:
-                        StanceTextValue = LOCTEXT("BalancedStance", "Stance: Balanced");
-                        StanceColor = FLinearColor(0.8f, 0.2f, 1.0f);
-                        break;
-                }
-            }
+#if WITH_SLATE_DEBUGGING
+            FSlateDebugging::WidgetInvalidateEvent.Remove(WidgetInvalidatedHandle);
+#endif
+            WidgetInvalidatedHandle.Reset();
+            StatsWidgets.Reset();
         }
+        return;
     }
-    
-    // Update stats display
-    if (StanceText.IsValid())
+
+    // Invalidations counted since the previous tick belong to the frame that just finished
+    const int32 NumInvalidated = InvalidationsSinceLastTick;
+    InvalidationsSinceLastTick = 0;
+
+    // The tree changes as enemy panels are pooled, so it is walked again every frame
+    StatsWidgets.Reset();
+    TArray<SWidget*, TInlineAllocator<64>> Pending;
+    Pending.Add(this);
+    while (Pending.Num() > 0)
     {
-        StanceText->SetText(StanceTextValue);
-        StanceText->SetColorAndOpacity(FSlateColor(StanceColor));
+        SWidget* Widget = Pending.Pop(EAllowShrinking::No);
+        StatsWidgets.Add(Widget);
+
+        FChildren* Children = Widget->GetChildren();
+        for (int32 Index = 0; Children && Index < Children->Num(); Index++)
+        {
+            Pending.Add(&Children->GetChildAt(Index).Get());
+        }
     }
-    
-    if (ShardsText.IsValid())
+
+#if WITH_SLATE_DEBUGGING
+    if (!WidgetInvalidatedHandle.IsValid())
     {
-        FText ShardsTextValue = FText::Format(LOCTEXT("ActiveShardsFormat", "Active: {0} Soul / {1} Power"), SoulActive, PowerActive);
-        ShardsText->SetText(ShardsTextValue);
+        WidgetInvalidatedHandle = FSlateDebugging::WidgetInvalidateEvent.AddSP(this, &STrinityFlowHUD::OnWidgetInvalidated);
     }
-    
-    if (InactiveShardsText.IsValid())
+#endif
+
+    TRINITYFLOW_INC_COUNTER(HUDWidgets, StatsWidgets.Num());
+    TRINITYFLOW_INC_COUNTER(HUDWidgetInvalidations, NumInvalidated);
+
+    if (GEngine)
     {
-        FText InactiveShardsTextValue = FText::Format(LOCTEXT("InactiveShardsFormat", "Inactive: {0} Soul / {1} Power"), SoulInactive, PowerInactive);
-        InactiveShardsText->SetText(InactiveShardsTextValue);
+        static constexpr uint64 WidgetStatsMessageKey = 0x7F1F0001;
+        GEngine->AddOnScreenDebugMessage(WidgetStatsMessageKey, 0.0f, FColor::Cyan,
+            FString::Printf(TEXT("HUD widgets: %d, invalidated last frame: %d, static sections cached: %s"),
+                StatsWidgets.Num(), NumInvalidated, bCachingStaticPanels ? TEXT("yes") : TEXT("no")));
     }
-    
-    if (DamageBonusText.IsValid())
+}
+
+#if WITH_SLATE_DEBUGGING
+void STrinityFlowHUD::OnWidgetInvalidated(const FSlateDebuggingInvalidateArgs& Args)
+{
+    if (StatsWidgets.Contains(Args.WidgetInvalidated))
     {
-        FText DamageTextValue = FText::Format(LOCTEXT("DamageFormat", "Damage: +{0}% Soul / +{1}% Physical"), 
-            FMath::RoundToInt(SoulBonus * 100), FMath::RoundToInt(PhysicalBonus * 100));
-        DamageBonusText->SetText(DamageTextValue);
+        InvalidationsSinceLastTick++;
     }
 }
+#endif
+#endif
 
-void STrinityFlowHUD::UpdateCombatState(bool bInCombat)
+void STrinityFlowHUD::SyncViewModel(const FTrinityFlowHUDViewModel& ViewModel)
 {
-    if (CombatStateText.IsValid())
+    // Nothing was written since the last sync
+    if (ViewModel.GetVersion() == SeenViewModelVersion)
+    {
+        return;
+    }
+    SeenViewModelVersion = ViewModel.GetVersion();
+
+    if (ViewModel.GetPlayerHealth().Consume(SeenHealthVersion) && HealthBar.IsValid())
     {
-        if (bInCombat)
+        HealthBar->SetHealthPercentage(ViewModel.GetPlayerHealth().Get());
+    }
+
+    if (ViewModel.GetCooldownSeconds().Consume(SeenCooldownsVersion))
+    {
+        const FIntVector4& Cooldowns = ViewModel.GetCooldownSeconds().Get();
+        if (LeftWeaponPanel.IsValid())
         {
-            CombatStateText->SetText(LOCTEXT("InCombat", "IN COMBAT"));
-            CombatStateText->SetColorAndOpacity(FSlateColor(FLinearColor::Red));
+            LeftWeaponPanel->SetCooldowns(Cooldowns.X, Cooldowns.Y);
         }
-        else
+        if (RightWeaponPanel.IsValid())
         {
-            CombatStateText->SetText(LOCTEXT("NonCombat", "NON-COMBAT"));
-            CombatStateText->SetColorAndOpacity(FSlateColor(FLinearColor::Green));
+            RightWeaponPanel->SetCooldowns(Cooldowns.Z, Cooldowns.W);
         }
     }
-}
 
-void STrinityFlowHUD::AddDamageNumber(const FVector& WorldLocation, float Damage, bool bIsEcho, EDamageType DamageType)
-{
-    // Create new damage number widget
-    TSharedPtr<STrinityFlowDamageNumber> NewDamageNumber;
-    
-    DamageNumberOverlay->AddSlot()
-    [
-        SAssignNew(NewDamageNumber, STrinityFlowDamageNumber)
-        .WorldLocation(WorldLocation)
-        .Damage(Damage)
-        .bIsEcho(bIsEcho)
-        .DamageType(DamageType)
-    ];
-    
-    DamageNumbers.Add(NewDamageNumber);
-}
-
-void STrinityFlowHUD::UpdateEnemyInfoPanels(const FGeometry& AllottedGeometry)
-{
-    if (!UIManager || !UIManager->GetWorld())
+    if (ViewModel.GetStance().Consume(SeenStanceVersion) && StanceText.IsValid())
     {
-        return;
+        FText StanceTextValue;
+        FLinearColor StanceColor;
+        switch (ViewModel.GetStance().Get())
+        {
+            case EStanceType::Soul:
+                StanceTextValue = LOCTEXT("SoulStance", "Stance: Soul");
+                StanceColor = FLinearColor(0.0f, 0.5f, 1.0f);
+                break;
+            case EStanceType::Power:
+                StanceTextValue = LOCTEXT("PowerStance", "Stance: Power");
+                StanceColor = FLinearColor(1.0f, 0.5f, 0.0f);
+                break;
+            case EStanceType::Balanced:
+            default:
+                StanceTextValue = LOCTEXT("BalancedStance", "Stance: Balanced");
+                StanceColor = FLinearColor(0.8f, 0.2f, 1.0f);
+                break;
+        }
+        StanceText->SetText(StanceTextValue);
+        StanceText->SetColorAndOpacity(FSlateColor(StanceColor));
     }
 
-    const TArray<AEnemyBase*>& Enemies = UIManager->GetRegisteredEnemies();
-    TSet<AEnemyBase*> CurrentEnemies(Enemies);
-    TSet<AEnemyBase*> KnownEnemies;
-    for (auto const& [Enemy, Panel] : EnemyInfoPanels)
+    if (ViewModel.GetShardCounts().Consume(SeenShardsVersion))
     {
-        KnownEnemies.Add(Enemy);
+        const FHUDShardCounts& Counts = ViewModel.GetShardCounts().Get();
+        if (ShardsText.IsValid())
+        {
+            ShardsText->SetText(FText::Format(LOCTEXT("ActiveShardsFormat", "Active: {0} Soul / {1} Power"), Counts.SoulActive, Counts.PowerActive));
+        }
+        if (InactiveShardsText.IsValid())
+        {
+            InactiveShardsText->SetText(FText::Format(LOCTEXT("InactiveShardsFormat", "Inactive: {0} Soul / {1} Power"), Counts.SoulInactive, Counts.PowerInactive));
+        }
     }
 
-    // Remove panels for enemies that are no longer registered
-    TSet<AEnemyBase*> EnemiesToRemove = KnownEnemies.Difference(CurrentEnemies);
-    for (AEnemyBase* Enemy : EnemiesToRemove)
+    if (ViewModel.GetDamageBonusPercent().Consume(SeenDamageBonusVersion) && DamageBonusText.IsValid())
     {
-        if (EnemyInfoPanels.Contains(Enemy))
-        {
-            EnemyInfoOverlay->RemoveSlot(EnemyInfoPanels[Enemy].ToSharedRef());
-            EnemyInfoPanels.Remove(Enemy);
-        }
+        const FIntPoint& BonusPercent = ViewModel.GetDamageBonusPercent().Get();
+        DamageBonusText->SetText(FText::Format(LOCTEXT("DamageFormat", "Damage: +{0}% Soul / +{1}% Physical"), BonusPercent.X, BonusPercent.Y));
     }
 
-    // Add panels for new enemies and update existing ones
-    for (AEnemyBase* Enemy : Enemies)
+    if (ViewModel.GetInCombat().Consume(SeenCombatVersion) && CombatStateText.IsValid())
     {
-        TSharedPtr<STrinityFlowEnemyInfoPanel> Panel = EnemyInfoPanels.FindRef(Enemy);
-        if (!Panel.IsValid())
+        if (ViewModel.GetInCombat().Get())
         {
-            SAssignNew(Panel, STrinityFlowEnemyInfoPanel).Enemy(Enemy);
-            EnemyInfoOverlay->AddSlot()
-            .HAlign(HAlign_Left)
-            .VAlign(VAlign_Top)
-            [
-                Panel.ToSharedRef()
-            ];
-            EnemyInfoPanels.Add(Enemy, Panel);
+            CombatStateText->SetText(LOCTEXT("InCombat", "IN COMBAT"));
+            CombatStateText->SetColorAndOpacity(FSlateColor(FLinearColor::Red));
+        }
+        else
+        {
+            CombatStateText->SetText(LOCTEXT("NonCombat", "NON-COMBAT"));
+            CombatStateText->SetColorAndOpacity(FSlateColor(FLinearColor::Green));
         }
+    }
 
-        // Update panel position and content
-        FVector2D ScreenPosition;
-        if (APlayerController* PC = UIManager->GetWorld()->GetFirstPlayerController())
+    if (StanceBar.IsValid())
+    {
+        if (ViewModel.GetStanceBarVisible().Consume(SeenStanceBarVersion))
         {
-            if (PC->ProjectWorldLocationToScreen(Enemy->GetActorLocation() + FVector(0, 0, 100), ScreenPosition))
+            if (ViewModel.GetStanceBarVisible().Get())
             {
-                Panel->SetVisibility(EVisibility::Visible);
-                // Use RenderTransform to position the panel
-                Panel->SetRenderTransform(FSlateRenderTransform(ScreenPosition));
-                Panel->Update();
+                StanceBar->Show();
             }
             else
             {
-                Panel->SetVisibility(EVisibility::Hidden);
+                StanceBar->Hide();
             }
         }
+
+        if (ViewModel.GetStanceFlow().Consume(SeenStanceFlowVersion))
+        {
+            StanceBar->SetIndicatorPosition(ViewModel.GetStanceFlow().Get());
+        }
     }
 }
 
-void STrinityFlowHUD::ShowDefenseTiming(float Duration, float PerfectStart, float PerfectEnd)
+void STrinityFlowHUD::AddDamageNumber(const FVector& WorldLocation, float Damage, bool bIsEcho, EDamageType DamageType, const AActor* Target)
 {
-    // No longer used - timing bars are shown per enemy
+    if (DamageNumberLayer.IsValid())
+    {
+        DamageNumberLayer->AddDamageNumber(WorldLocation, Damage, bIsEcho, DamageType, Target,
+            UCombatReplaySubsystem::GetRandomStream(UIManager).FRandRange(-30.0f, 30.0f));
+    }
 }
 
-void STrinityFlowHUD::HideDefenseTiming()
+void STrinityFlowHUD::AddEnemy(AEnemyBase* Enemy)
 {
-    // No longer used - timing bars are shown per enemy
+    if (EnemyInfoLayer.IsValid())
+    {
+        EnemyInfoLayer->AddEnemy(Enemy);
+    }
 }
 
-void STrinityFlowHUD::ShowEnemyDefenseTiming(AEnemyBase* Enemy, float Duration, float PerfectStart, float PerfectEnd)
+void STrinityFlowHUD::RemoveEnemy(AEnemyBase* Enemy)
 {
-    if (!Enemy)
+    if (EnemyInfoLayer.IsValid())
     {
-        return;
-    }
-    
-    TSharedPtr<STrinityFlowEnemyInfoPanel> Panel = EnemyInfoPanels.FindRef(Enemy);
-    if (Panel.IsValid())
-    {
-        Panel->ShowTimingBar(Duration, PerfectStart, PerfectEnd);
+        EnemyInfoLayer->RemoveEnemy(Enemy);
     }
 }
 
-void STrinityFlowHUD::HideEnemyDefenseTiming(AEnemyBase* Enemy)
+void STrinityFlowHUD::ShowDefenseTiming(float Duration, float PerfectStart, float PerfectEnd)
 {
-    if (!Enemy)
-    {
-        return;
-    }
-    
-    TSharedPtr<STrinityFlowEnemyInfoPanel> Panel = EnemyInfoPanels.FindRef(Enemy);
-    if (Panel.IsValid())
-    {
-        Panel->HideTimingBar();
-    }
+    // No longer used - timing bars are shown per enemy
 }
 
-void STrinityFlowHUD::ShowStanceBar()
+void STrinityFlowHUD::HideDefenseTiming()
 {
-    if (StanceBar.IsValid())
-    {
-        StanceBar->Show();
-    }
+    // No longer used - timing bars are shown per enemy
 }
 
-void STrinityFlowHUD::HideStanceBar()
+void STrinityFlowHUD::ShowEnemyDefenseTiming(AEnemyBase* Enemy, float Duration, float PerfectStart, float PerfectEnd)
 {
-    if (StanceBar.IsValid())
+    if (EnemyInfoLayer.IsValid())
     {
-        StanceBar->Hide();
+        EnemyInfoLayer->ShowTimingBar(Enemy, Duration, PerfectStart, PerfectEnd);
     }
 }
 
-void STrinityFlowHUD::UpdateStanceBar(float FlowPosition)
+void STrinityFlowHUD::HideEnemyDefenseTiming(AEnemyBase* Enemy)
 {
-    if (StanceBar.IsValid())
+    if (EnemyInfoLayer.IsValid())
     {
-        StanceBar->SetIndicatorPosition(FlowPosition);
+        EnemyInfoLayer->HideTimingBar(Enemy);
     }
 }
 
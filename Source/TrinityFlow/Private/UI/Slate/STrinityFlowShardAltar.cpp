@@ -281,6 +281,9 @@ void STrinityFlowShardAltar::Construct(const FArguments& InArgs)
             ]
         ]
     ];
+
+    // Only ticks while the open animation plays or an activation is running
+    SetCanTick(false);
 }
 
 void STrinityFlowShardAltar::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
@@ -305,40 +308,53 @@ void STrinityFlowShardAltar::Tick(const FGeometry& AllottedGeometry, const doubl
         }
     }
     
-    // Update activation progress
+    // Progress is the one value that moves every frame; completion arrives as an event
     if (bIsActivating && CurrentAltar)
     {
-        float Progress = CurrentAltar->GetActivationProgress();
-        UpdateActivationProgress(Progress);
-        
-        // Check if activation is complete or if altar is no longer activating
-        if (Progress >= 1.0f || !CurrentAltar->IsActivating())
+        UpdateActivationProgress(CurrentAltar->GetActivationProgress());
+    }
+
+    UpdateTickState();
+}
+
+void STrinityFlowShardAltar::UpdateTickState()
+{
+    SetCanTick(OpenAnimation.IsPlaying() || bIsActivating);
+}
+
+void STrinityFlowShardAltar::OnActivationEnded(bool bCompleted)
+{
+    if (CurrentAltar)
+    {
+        CurrentAltar->OnActivationEndedNative.Remove(ActivationEndedHandle);
+    }
+    ActivationEndedHandle.Reset();
+
+    bIsActivating = false;
+    ActivationProgress = 0.0f;
+
+    if (ProgressOverlay.IsValid())
+    {
+        ProgressOverlay->SetVisibility(EVisibility::Collapsed);
+    }
+
+    // Close the UI after a short delay to show completion
+    if (bCompleted)
+    {
+        FTimerHandle CloseTimer;
+        if (UIManager && UIManager->GetWorld())
         {
-            bIsActivating = false;
-            ActivationProgress = 0.0f;
-            
-            if (ProgressOverlay.IsValid())
-            {
-                ProgressOverlay->SetVisibility(EVisibility::Collapsed);
-            }
-            
-            // Close the UI after a short delay to show completion
-            if (Progress >= 1.0f)
+            UIManager->GetWorld()->GetTimerManager().SetTimer(CloseTimer, [this]()
             {
-                FTimerHandle CloseTimer;
-                if (UIManager && UIManager->GetWorld())
+                if (UIManager)
                 {
-                    UIManager->GetWorld()->GetTimerManager().SetTimer(CloseTimer, [this]()
-                    {
-                        if (UIManager)
-                        {
-                            UIManager->ShowInGameHUD();
-                        }
-                    }, 0.5f, false);
+                    UIManager->ShowInGameHUD();
                 }
-            }
+            }, 0.5f, false);
         }
     }
+
+    UpdateTickState();
 }
 
 void STrinityFlowShardAltar::SetAltar(AShardAltar* InAltar)
@@ -386,6 +402,7 @@ void STrinityFlowShardAltar::PlayOpenAnimation()
     {
         AnimationAlpha = 0.0f;
         OpenAnimation.Play(this->AsShared());
+        UpdateTickState();
     }
 }
 
@@ -546,8 +563,8 @@ void STrinityFlowShardAltar::StartActivation()
         return;
     }
     
-    // Start activation
-    CurrentAltar->StartSelectiveActivation(PlayerCharacter, SoulAmount, PowerAmount);
+    // Listen before starting; an altar without a puzzle finishes inside the call
+    ActivationEndedHandle = CurrentAltar->OnActivationEndedNative.AddSP(this, &STrinityFlowShardAltar::OnActivationEnded);
     bIsActivating = true;
     ActivationProgress = 0.0f;
     
@@ -556,6 +573,16 @@ void STrinityFlowShardAltar::StartActivation()
     {
         ProgressOverlay->SetVisibility(EVisibility::Visible);
     }
+    UpdateTickState();
+
+    // Start activation
+    CurrentAltar->StartSelectiveActivation(PlayerCharacter, SoulAmount, PowerAmount);
+
+    // A rejected activation never starts, so no end event will come
+    if (bIsActivating && !CurrentAltar->IsActivating())
+    {
+        OnActivationEnded(false);
+    }
 }
 
 void STrinityFlowShardAltar::UpdateActivationProgress(float Progress)
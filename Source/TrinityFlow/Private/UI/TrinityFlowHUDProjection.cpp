@@ -0,0 +1,160 @@
+#include "UI/TrinityFlowHUDProjection.h"
+#include "Core/TrinityFlowProfiling.h"
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "SceneView.h"
+
+void FTrinityFlowHUDProjection::Update(UWorld* World)
+{
+    TRINITYFLOW_SCOPE_CYCLE_COUNTER(HUDProjection);
+
+    bHasView = CaptureView(World);
+
+    const int32 NumSlots = AnchorActors.Num();
+    for (int32 Index = 0; Index < NumSlots; Index++)
+    {
+        if (const AActor* Actor = AnchorActors[Index].Get())
+        {
+            AnchorWorldPoints[Index] = Actor->GetActorLocation() + AnchorOffsets[Index];
+        }
+    }
+
+    ProjectRange(AnchorWorldPoints.GetData(), ScreenPositions.GetData(), Flags.GetData(), NumSlots);
+
+    // Free slots and anchors whose actor is gone keep their last point; report them as off screen
+    for (int32 Index = 0; Index < NumSlots; Index++)
+    {
+        if (!AnchorActors[Index].IsValid())
+        {
+            Flags[Index] = EHUDProjectionFlags::None;
+        }
+    }
+
+    TRINITYFLOW_INC_COUNTER(HUDAnchorsProjected, NumSlots);
+}
+
+bool FTrinityFlowHUDProjection::CaptureView(UWorld* World)
+{
+    APlayerController* PC = World && GEngine ? GEngine->GetFirstLocalPlayerController(World) : nullptr;
+    ULocalPlayer* LocalPlayer = PC ? PC->GetLocalPlayer() : nullptr;
+    if (!LocalPlayer || !LocalPlayer->ViewportClient)
+    {
+        return false;
+    }
+
+    FSceneViewProjectionData ProjectionData;
+    if (!LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, ProjectionData))
+    {
+        return false;
+    }
+
+    ViewProjection = ProjectionData.ComputeViewProjectionMatrix();
+    ViewRect = ProjectionData.GetConstrainedViewRect();
+    return true;
+}
+
+int32 FTrinityFlowHUDProjection::AddAnchor(const AActor* Actor, const FVector& Offset)
+{
+    int32 Handle;
+    if (FreeAnchors.Num() > 0)
+    {
+        Handle = FreeAnchors.Pop(EAllowShrinking::No);
+    }
+    else
+    {
+        Handle = AnchorActors.AddDefaulted();
+        AnchorOffsets.AddZeroed();
+        AnchorWorldPoints.AddZeroed();
+        ScreenPositions.AddZeroed();
+        Flags.Add(EHUDProjectionFlags::None);
+    }
+
+    AnchorActors[Handle] = Actor;
+    AnchorOffsets[Handle] = Offset;
+    Flags[Handle] = EHUDProjectionFlags::None;
+
+    if (Actor)
+    {
+        AnchorWorldPoints[Handle] = Actor->GetActorLocation() + Offset;
+        ProjectRange(&AnchorWorldPoints[Handle], &ScreenPositions[Handle], &Flags[Handle], 1);
+    }
+
+    return Handle;
+}
+
+void FTrinityFlowHUDProjection::RemoveAnchor(int32 Handle)
+{
+    if (!AnchorActors.IsValidIndex(Handle))
+    {
+        return;
+    }
+
+    AnchorActors[Handle].Reset();
+    Flags[Handle] = EHUDProjectionFlags::None;
+    FreeAnchors.Add(Handle);
+}
+
+void FTrinityFlowHUDProjection::ProjectPoints(TConstArrayView<FVector> WorldPoints, TArray<FVector2f>& OutPositions, TArray<EHUDProjectionFlags>& OutFlags) const
+{
+    OutPositions.SetNumUninitialized(WorldPoints.Num(), EAllowShrinking::No);
+    OutFlags.SetNumUninitialized(WorldPoints.Num(), EAllowShrinking::No);
+    ProjectRange(WorldPoints.GetData(), OutPositions.GetData(), OutFlags.GetData(), WorldPoints.Num());
+}
+
+void FTrinityFlowHUDProjection::ProjectRange(const FVector* WorldPoints, FVector2f* OutPositions, EHUDProjectionFlags* OutFlags, int32 Num) const
+{
+    if (!bHasView)
+    {
+        for (int32 Index = 0; Index < Num; Index++)
+        {
+            OutFlags[Index] = EHUDProjectionFlags::None;
+        }
+        return;
+    }
+
+    // Same maths as FSceneView::ProjectWorldToScreen, with the matrix rows loaded into registers once
+    const VectorRegister4Double Row0 = VectorLoad(ViewProjection.M[0]);
+    const VectorRegister4Double Row1 = VectorLoad(ViewProjection.M[1]);
+    const VectorRegister4Double Row2 = VectorLoad(ViewProjection.M[2]);
+    const VectorRegister4Double Row3 = VectorLoad(ViewProjection.M[3]);
+
+    const double MinX = ViewRect.Min.X;
+    const double MinY = ViewRect.Min.Y;
+    const double Width = ViewRect.Width();
+    const double Height = ViewRect.Height();
+
+    for (int32 Index = 0; Index < Num; Index++)
+    {
+        const FVector& Point = WorldPoints[Index];
+
+        VectorRegister4Double Clip = VectorMultiplyAdd(VectorSetFloat1(Point.X), Row0, Row3);
+        Clip = VectorMultiplyAdd(VectorSetFloat1(Point.Y), Row1, Clip);
+        Clip = VectorMultiplyAdd(VectorSetFloat1(Point.Z), Row2, Clip);
+
+        double ClipValues[4];
+        VectorStore(Clip, ClipValues);
+
+        if (ClipValues[3] <= 0.0)
+        {
+            OutFlags[Index] = EHUDProjectionFlags::None;
+            continue;
+        }
+
+        const double RHW = 1.0 / ClipValues[3];
+        const double NormalizedX = ClipValues[0] * RHW;
+        const double NormalizedY = ClipValues[1] * RHW;
+
+        OutPositions[Index] = FVector2f(
+            static_cast<float>(MinX + (0.5 + NormalizedX * 0.5) * Width),
+            static_cast<float>(MinY + (0.5 - NormalizedY * 0.5) * Height));
+
+        const bool bOnScreen = FMath::Abs(NormalizedX) <= 1.0 && FMath::Abs(NormalizedY) <= 1.0;
+        OutFlags[Index] = bOnScreen
+            ? EHUDProjectionFlags::InFront | EHUDProjectionFlags::OnScreen
+            : EHUDProjectionFlags::InFront;
+    }
+}
@@ -13,6 +13,9 @@
 #include "Core/StateComponent.h"
 #include "Core/StanceComponent.h"
 #include "Core/HealthComponent.h"
+#include "Core/CombatantHandleSubsystem.h"
+#include "Core/CombatResolutionSubsystem.h"
+#include "Core/TrinityFlowLog.h"
 #include "Enemy/EnemyBase.h"
 #include "World/ShardAltar.h"
 #include "TrinityFlowCharacter.h"
@@ -213,47 +216,47 @@ void UTrinityFlowUIManager::SetInputModeGame()
     }
 }
 
-void UTrinityFlowUIManager::AddDamageNumber(const FVector& WorldLocation, float Damage, bool bIsEcho, EDamageType DamageType)
+void UTrinityFlowUIManager::AddDamageNumber(const FVector& WorldLocation, float Damage, bool bIsEcho, EDamageType DamageType, AActor* Target)
 {
     if (HUDWidget.IsValid())
     {
-        HUDWidget->AddDamageNumber(WorldLocation, Damage, bIsEcho, DamageType);
+        HUDWidget->AddDamageNumber(WorldLocation, Damage, bIsEcho, DamageType, Target);
     }
 }
 
 void UTrinityFlowUIManager::UpdatePlayerHealth(float HealthPercentage)
 {
-    if (HUDWidget.IsValid())
-    {
-        HUDWidget->UpdatePlayerHealth(HealthPercentage);
-    }
+    HUDViewModel.SetPlayerHealth(HealthPercentage);
 }
 
 void UTrinityFlowUIManager::UpdateWeaponCooldowns(float QCooldown, float TabCooldown, float ECooldown, float RCooldown)
 {
-    if (HUDWidget.IsValid())
-    {
-        HUDWidget->UpdateWeaponCooldowns(QCooldown, TabCooldown, ECooldown, RCooldown);
-    }
+    HUDViewModel.SetCooldowns(QCooldown, TabCooldown, ECooldown, RCooldown);
 }
 
 void UTrinityFlowUIManager::UpdatePlayerStats(int32 SoulActive, int32 PowerActive, int32 SoulInactive, int32 PowerInactive, float SoulBonus, float PhysicalBonus)
 {
-    if (HUDWidget.IsValid())
-    {
-        HUDWidget->UpdatePlayerStats(SoulActive, PowerActive, SoulInactive, PowerInactive, SoulBonus, PhysicalBonus);
-    }
+    FHUDShardCounts Counts;
+    Counts.SoulActive = SoulActive;
+    Counts.PowerActive = PowerActive;
+    Counts.SoulInactive = SoulInactive;
+    Counts.PowerInactive = PowerInactive;
+    HUDViewModel.SetShardCounts(Counts);
+    HUDViewModel.SetDamageBonus(SoulBonus, PhysicalBonus);
+}
+
+void UTrinityFlowUIManager::UpdateStance(EStanceType NewStance)
+{
+    HUDViewModel.SetStance(NewStance);
 }
 
 void UTrinityFlowUIManager::UpdateCombatState(bool bInCombat)
 {
-    if (HUDWidget.IsValid())
-    {
-        HUDWidget->UpdateCombatState(bInCombat);
-    }
+    const bool bWasInCombat = HUDViewModel.GetInCombat().Get();
+    HUDViewModel.SetInCombat(bInCombat);
     
     // Reset stance flow when leaving combat
-    if (!bInCombat)
+    if (bWasInCombat && !bInCombat)
     {
         if (APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0))
         {
@@ -273,11 +276,10 @@ void UTrinityFlowUIManager::RegisterEnemy(AEnemyBase* Enemy)
     if (Enemy)
     {
         RegisteredEnemies.AddUnique(Enemy);
-        
-        // Subscribe to enemy's damage events
-        if (UHealthComponent* HealthComp = Enemy->FindComponentByClass<UHealthComponent>())
+
+        if (HUDWidget.IsValid())
         {
-            HealthComp->OnDamageDealt.AddDynamic(this, &UTrinityFlowUIManager::OnDamageDealt);
+            HUDWidget->AddEnemy(Enemy);
         }
     }
 }
@@ -287,11 +289,10 @@ void UTrinityFlowUIManager::UnregisterEnemy(AEnemyBase* Enemy)
     if (Enemy)
     {
         RegisteredEnemies.Remove(Enemy);
-        
-        // Unsubscribe from enemy's damage events
-        if (UHealthComponent* HealthComp = Enemy->FindComponentByClass<UHealthComponent>())
+
+        if (HUDWidget.IsValid())
         {
-            HealthComp->OnDamageDealt.RemoveDynamic(this, &UTrinityFlowUIManager::OnDamageDealt);
+            HUDWidget->RemoveEnemy(Enemy);
         }
     }
 }
@@ -301,6 +302,41 @@ const TArray<AEnemyBase*>& UTrinityFlowUIManager::GetRegisteredEnemies() const
     return RegisteredEnemies;
 }
 
+void UTrinityFlowUIManager::BindCombatEvents(UWorld* World)
+{
+    if (FCombatEventBus* OldBus = UCombatResolutionSubsystem::GetEventBus(BoundEventWorld.Get()))
+    {
+        OldBus->Unsubscribe(ECombatEventType::DamageDealt, DamageEventHandle);
+    }
+    DamageEventHandle.Reset();
+    BoundEventWorld = World;
+
+    // Damage numbers only need the frame's events once, after resolution
+    if (FCombatEventBus* EventBus = UCombatResolutionSubsystem::GetEventBus(World))
+    {
+        DamageEventHandle = EventBus->SubscribeBatched(ECombatEventType::DamageDealt,
+            FOnCombatEventBatch::FDelegate::CreateUObject(this, &UTrinityFlowUIManager::OnDamageEvents));
+    }
+}
+
+void UTrinityFlowUIManager::OnDamageEvents(TArrayView<const FCombatEvent> Events)
+{
+    APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+
+    for (const FCombatEvent& Event : Events)
+    {
+        if (Event.Target)
+        {
+            OnDamageDealt(Event.Target, Event.Amount, Event.Instigator, Event.DamageType);
+        }
+        else if (PlayerPawn && Event.Instigator == PlayerPawn)
+        {
+            // Horde entities have no actor to follow or mark; the number floats from the hit location
+            AddDamageNumber(Event.Location, Event.Amount, false, Event.DamageType);
+        }
+    }
+}
+
 void UTrinityFlowUIManager::OnDamageDealt(AActor* DamagedActor, float ActualDamage, AActor* DamageInstigator, EDamageType DamageType)
 {
     if (APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0))
@@ -308,17 +344,17 @@ void UTrinityFlowUIManager::OnDamageDealt(AActor* DamagedActor, float ActualDama
         if (DamageInstigator == PlayerPawn && DamagedActor)
         {
             bool bIsEcho = false;
-            if (UStateComponent* StateComp = DamagedActor->FindComponentByClass<UStateComponent>())
+            if (UStateComponent* StateComp = UCombatantHandleSubsystem::Get(DamagedActor).State.Get())
             {
                 bIsEcho = StateComp->IsMarked() && DamageType == EDamageType::Soul;
             }
 
-            UE_LOG(LogTemp, Warning, TEXT("UIManager OnDamageDealt: Damage=%.1f, Type=%s, IsEcho=%s"), 
+            UE_LOG(LogTrinityFlowUI, VeryVerbose, TEXT("UIManager OnDamageDealt: Damage=%.1f, Type=%s, IsEcho=%s"), 
                 ActualDamage, 
                 DamageType == EDamageType::Soul ? TEXT("Soul") : TEXT("Physical"),
                 bIsEcho ? TEXT("Yes") : TEXT("No"));
 
-            AddDamageNumber(DamagedActor->GetActorLocation(), ActualDamage, bIsEcho, DamageType);
+            AddDamageNumber(DamagedActor->GetActorLocation(), ActualDamage, bIsEcho, DamageType, DamagedActor);
         }
     }
 }
@@ -381,24 +417,15 @@ void UTrinityFlowUIManager::HideDefenseTiming()
 
 void UTrinityFlowUIManager::ShowStanceBar()
 {
-    if (HUDWidget.IsValid())
-    {
-        HUDWidget->ShowStanceBar();
-    }
+    HUDViewModel.SetStanceBarVisible(true);
 }
 
 void UTrinityFlowUIManager::HideStanceBar()
 {
-    if (HUDWidget.IsValid())
-    {
-        HUDWidget->HideStanceBar();
-    }
+    HUDViewModel.SetStanceBarVisible(false);
 }
 
 void UTrinityFlowUIManager::UpdateStanceBar(float FlowPosition)
 {
-    if (HUDWidget.IsValid())
-    {
-        HUDWidget->UpdateStanceBar(FlowPosition);
-    }
+    HUDViewModel.SetStanceFlow(FlowPosition);
 }
\ No newline at end of file
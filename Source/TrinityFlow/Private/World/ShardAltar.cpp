@@ -136,6 +136,8 @@ void AShardAltar::CancelActivation()
         PendingShardsToActivate = 0;
         PendingSoulShardsToActivate = 0;
         PendingPowerShardsToActivate = 0;
+
+        OnActivationEndedNative.Broadcast(false);
     }
 }
 
@@ -263,7 +265,8 @@ void AShardAltar::CompleteActivation()
         PowerShardsActivated = InactivePower;
     }
     
-    if (SoulShardsActivated > 0 || PowerShardsActivated > 0)
+    const bool bCompleted = SoulShardsActivated > 0 || PowerShardsActivated > 0;
+    if (bCompleted)
     {
         OnAltarActivated.Broadcast(SoulShardsActivated, PowerShardsActivated, CurrentInteractor);
         OnActivationCompleted(CurrentInteractor, SoulShardsActivated + PowerShardsActivated);
@@ -284,6 +287,7 @@ void AShardAltar::CompleteActivation()
     PendingShardsToActivate = 0;
     
     OnAltarInteractionEnded.Broadcast();
+    OnActivationEndedNative.Broadcast(bCompleted);
 }
 
 void AShardAltar::CompleteSelectiveActivation()
@@ -311,7 +315,8 @@ void AShardAltar::CompleteSelectiveActivation()
         PowerShardsActivated = PendingPowerShardsToActivate;
     }
     
-    if (SoulShardsActivated > 0 || PowerShardsActivated > 0)
+    const bool bCompleted = SoulShardsActivated > 0 || PowerShardsActivated > 0;
+    if (bCompleted)
     {
         OnAltarActivated.Broadcast(SoulShardsActivated, PowerShardsActivated, CurrentInteractor);
         OnActivationCompleted(CurrentInteractor, SoulShardsActivated + PowerShardsActivated);
@@ -335,6 +340,7 @@ void AShardAltar::CompleteSelectiveActivation()
     PendingPowerShardsToActivate = 0;
     
     OnAltarInteractionEnded.Broadcast();
+    OnActivationEndedNative.Broadcast(bCompleted);
 }
 
 bool AShardAltar::AreGuardiansDefeated() const
@@ -2,11 +2,63 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "AI/EnemyPerceptionSubsystem.h"
 #include "AIState.generated.h"
 
 class UAIStateMachine;
 class AEnemyBase;
 class AEnemyAIController;
+class UFlowFieldSubsystem;
+
+/**
+ * World data an AI state decides on, gathered on the game thread before the parallel evaluate step
+ * The actor pointers are for Apply only; Evaluate must not dereference them.
+ */
+struct FAIStateSnapshot
+{
+	float DeltaTime = 0.0f;
+
+	AEnemyBase* Enemy = nullptr;
+	FVector EnemyLocation = FVector::ZeroVector;
+	float SightRange = 0.0f;
+	float AttackRange = 0.0f;
+	bool bCanAttack = false;
+
+	// Current target of the enemy
+	APawn* Target = nullptr;
+	FVector TargetLocation = FVector::ZeroVector;
+
+	// Local player, for detection while the enemy has no target
+	APawn* Player = nullptr;
+	FVector PlayerLocation = FVector::ZeroVector;
+
+	// Cached line of sight to the target (or to the player when within sight range and untargeted)
+	EEnemyVisibility Visibility = EEnemyVisibility::Unknown;
+
+	// Read-only during the evaluate step
+	const UFlowFieldSubsystem* FlowField = nullptr;
+};
+
+/**
+ * Outcome of the evaluate step, carried out by Apply on the game thread
+ */
+struct FAIStateDecision
+{
+	// Run the state's legacy Update instead (states that do not implement Evaluate)
+	bool bRunUpdate = false;
+
+	TSubclassOf<UAIState> NextState;
+
+	bool bAcquirePlayer = false;
+	bool bClearTarget = false;
+	bool bFaceTarget = false;
+	bool bStopPathFollowing = false;
+	bool bRefreshPath = false;
+	bool bAttack = false;
+
+	// Steering input for this frame (flow field)
+	FVector MoveInput = FVector::ZeroVector;
+};
 
 UCLASS(Abstract, Blueprintable)
 class TRINITYFLOW_API UAIState : public UObject
@@ -20,6 +72,13 @@ public:
 	virtual void Update(float DeltaTime);
 	virtual void Exit();
 
+	// Decision step; may run on a worker thread, so it may only read the snapshot and change this
+	// state's own fields (every state machine owns its state instances)
+	virtual void Evaluate(const FAIStateSnapshot& Snapshot, FAIStateDecision& OutDecision);
+
+	// Game thread step performing the decision's side effects; transitions happen last
+	virtual void Apply(const FAIStateSnapshot& Snapshot, const FAIStateDecision& Decision);
+
 	UFUNCTION(BlueprintCallable, Category = "AI State")
 	void TransitionToState(TSubclassOf<UAIState> NewStateClass);
 
@@ -7,6 +7,8 @@
 class UAIState;
 class AEnemyBase;
 class AEnemyAIController;
+class UEnemyDecisionSubsystem;
+struct FAIStateSnapshot;
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class TRINITYFLOW_API UAIStateMachine : public UActorComponent
@@ -30,6 +32,17 @@ public:
 	UFUNCTION(BlueprintPure, Category = "AI State Machine")
 	TSubclassOf<UAIState> GetCurrentStateClass() const { return CurrentStateClass; }
 
+	// The configured state class deriving from BaseClass (e.g. the enemy's Blueprint chase state), found
+	// among the states reachable from the initial state; null when the enemy has no such state
+	TSubclassOf<UAIState> FindStateClass(TSubclassOf<UAIState> BaseClass) const;
+
+	// Reads everything the current state decides on; game thread only. False when there is no state to run.
+	bool GatherSnapshot(float DeltaTime, FAIStateSnapshot& OutSnapshot);
+
+	// Transitions and pool reuses across all state machines since startup
+	static uint64 GetTotalTransitions() { return TotalTransitions; }
+	static uint64 GetTotalAllocationsAvoided() { return TotalAllocationsAvoided; }
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -46,5 +59,21 @@ private:
 	UPROPERTY()
 	AEnemyAIController* OwnerAIController;
 
+	// Batches this machine's evaluate step with every other enemy's; null runs it inline
+	UPROPERTY()
+	UEnemyDecisionSubsystem* DecisionSubsystem;
+
+	// One instance per state class, reused on every transition into that class
+	UPROPERTY()
+	TArray<UAIState*> StatePool;
+
+	static uint64 TotalTransitions;
+	static uint64 TotalAllocationsAvoided;
+
 	void CreateAndEnterState(TSubclassOf<UAIState> StateClass);
+
+	UAIState* FindOrCreatePooledState(TSubclassOf<UAIState> StateClass, bool& bOutCreated);
+
+	// Creates instances for the state and every state class it can transition to
+	void PrewarmStatePool(TSubclassOf<UAIState> StateClass);
 };
\ No newline at end of file
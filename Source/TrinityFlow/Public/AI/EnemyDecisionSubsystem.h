@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AI/AIState.h"
+#include "EnemyDecisionSubsystem.generated.h"
+
+class UAIStateMachine;
+
+/**
+ * Runs the AI decision phase for every enemy at once
+ * State machines enqueue a game-thread snapshot when they tick; the subsystem then evaluates all
+ * queued states with ParallelFor and applies the decisions (transitions, movement, facing,
+ * attacks) back on the game thread in enqueue order.
+ */
+UCLASS()
+class TRINITYFLOW_API UEnemyDecisionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem implementation
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject implementation
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Snapshot the machine's current state for this frame's decision phase
+	void Enqueue(UAIStateMachine* StateMachine, float DeltaTime);
+
+	// Profiling counters for the last decision phase
+	int32 GetDecisionsLastFrame() const { return DecisionsLastFrame; }
+	double GetEvaluateMsLastFrame() const { return EvaluateMsLastFrame; }
+	double GetApplyMsLastFrame() const { return ApplyMsLastFrame; }
+	bool WasParallelLastFrame() const { return bParallelLastFrame; }
+
+private:
+	struct FDecisionJob
+	{
+		TWeakObjectPtr<UAIStateMachine> StateMachine;
+		UAIState* State = nullptr;
+		FAIStateSnapshot Snapshot;
+		FAIStateDecision Decision;
+	};
+
+	TArray<FDecisionJob> Jobs;
+
+	int32 DecisionsLastFrame = 0;
+	double EvaluateMsLastFrame = 0.0;
+	double ApplyMsLastFrame = 0.0;
+	bool bParallelLastFrame = false;
+};
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/TrinityFlowTypes.h"
+#include "Core/DamageCalculator.h"
+#include "Core/CombatEventBus.h"
+#include "EnemyHordeSubsystem.generated.h"
+
+class AEnemyBase;
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+
+/**
+ * Behaviour of a horde entity, mirroring the actor AI states
+ */
+enum class EHordeAIState : uint8
+{
+	Idle,
+	Chase,
+	Attack
+};
+
+/**
+ * Shared, immutable data for every horde entity of one enemy class
+ * Resolved once from the class defaults and its character stats
+ */
+struct FHordeArchetype
+{
+	TSubclassOf<AEnemyBase> EnemyClass;
+	FCharacterResources Resources;
+	ECharacterTag Tags = ECharacterTag::None;
+	float MovementSpeed = 300.0f;
+	float SightRange = 1500.0f;
+	float AttackRange = 300.0f;
+	float AttackInterval = 1.0f;
+};
+
+/**
+ * Stable reference to a horde entity; stays valid while the entity is moved around in storage
+ */
+struct FHordeEntityId
+{
+	int32 Id = INDEX_NONE;
+
+	bool IsValid() const { return Id != INDEX_NONE; }
+	bool operator==(const FHordeEntityId& Other) const { return Id == Other.Id; }
+};
+
+/**
+ * Lightweight representation for large enemy counts
+ * Enemies far from the player live here as rows of structure-of-arrays data (resources, tags,
+ * state flags, AI state) and are updated by one idle/chase/attack pass per frame instead of a
+ * full ACharacter with components, movement and an AI controller each.
+ * Entities that come within PromoteDistance of the player are promoted to AEnemyBase actors;
+ * promoted actors that fall back to idle beyond DemoteDistance are demoted again. An entity whose
+ * attack comes due with line of sight to the player is promoted on the spot, so every enemy hit goes
+ * through the actor attack and the player's defensive window.
+ * Damage goes through FDamageCalculator::CalculateDamageBatch, the same contract as actor damage.
+ * Weapons and area attacks reach entities through FindEntityInCone/ApplyRadialDamage with damage from
+ * UCombatAttributeSubsystem::MakeAttackDamage, as for actor hits; every hit and death is published on
+ * the combat event bus with a null target and the entity's location.
+ */
+UCLASS()
+class TRINITYFLOW_API UEnemyHordeSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem implementation
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject implementation
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UEnemyHordeSubsystem* Get(const UObject* WorldContextObject);
+
+	FHordeEntityId SpawnEntity(TSubclassOf<AEnemyBase> EnemyClass, const FVector& Location, const FRotator& Rotation);
+	void DestroyEntity(FHordeEntityId Entity);
+
+	bool GetEntityLocation(FHordeEntityId Entity, FVector& OutLocation) const;
+
+	// Nearest entity within Range whose direction from Origin is within HalfAngleDegrees of Direction
+	FHordeEntityId FindEntityInCone(const FVector& Origin, const FVector& Direction, float Range, float HalfAngleDegrees) const;
+
+	// Damages every entity whose location is within Radius of Center, returns the number of entities hit
+	int32 ApplyRadialDamage(const FVector& Center, float Radius, const FDamageInfo& DamageInfo);
+
+	// Damages one entity, returns the damage dealt
+	float ApplyDamage(FHordeEntityId Entity, const FDamageInfo& DamageInfo, const FVector& DamageDirection);
+
+	// Instanced mesh used to draw entities (optional; without it entities are invisible until promoted)
+	void SetRepresentationMesh(UStaticMesh* Mesh);
+
+	int32 GetNumEntities() const { return Locations.Num(); }
+	int32 GetNumPromoted() const { return PromotedEnemies.Num(); }
+	int32 GetPromotionsLastFrame() const { return PromotionsLastFrame; }
+	int32 GetDemotionsLastFrame() const { return DemotionsLastFrame; }
+
+	// Distance thresholds for switching between horde and actor representation (hysteresis)
+	static constexpr float PromoteDistance = 2500.0f;
+	static constexpr float DemoteDistance = 4000.0f;
+
+	// Actor spawns are expensive; spread promotions over frames
+	static constexpr int32 MaxPromotionsPerFrame = 4;
+
+private:
+	TArray<FHordeArchetype> Archetypes;
+
+	// Entity storage, one row per entity; rows are swap-removed
+	TArray<FVector> Locations;
+	TArray<FVector> Forwards;
+	TArray<FCharacterResources> Resources;
+	TArray<ECharacterTag> Tags;
+	TArray<ECharacterState> States;
+	TArray<EHordeAIState> AIStates;
+	TArray<float> AttackCooldowns;
+	TArray<uint16> ArchetypeIndices;
+	TArray<int32> RowIds;
+
+	// Id -> row lookup with a free list for recycled ids
+	TArray<int32> IdToRow;
+	TArray<int32> FreeIds;
+
+	// Actors this subsystem spawned by promotion and may demote again
+	TArray<TWeakObjectPtr<AEnemyBase>> PromotedEnemies;
+
+	// Scratch buffers for batched damage
+	FDamageBatch DamageBatch;
+	TArray<float> BatchDamage;
+	TArray<int32> BatchRows;
+	FDamageResponseCache DamageResponseCache;
+
+	UPROPERTY()
+	AActor* RepresentationActor = nullptr;
+
+	UPROPERTY()
+	UInstancedStaticMeshComponent* RepresentationInstances = nullptr;
+
+	TArray<FTransform> InstanceTransforms;
+
+	int32 PromotionsLastFrame = 0;
+	int32 DemotionsLastFrame = 0;
+
+	int32 FindOrAddArchetype(TSubclassOf<AEnemyBase> EnemyClass);
+	int32 AddRow(int32 ArchetypeIndex, const FVector& Location, const FVector& Forward, const FCharacterResources& InResources, ECharacterState InStates);
+	void RemoveRow(int32 Row);
+
+	// Per-frame passes
+	void ProcessIdle(const FVector& PlayerLocation);
+	void ProcessChase(const FVector& PlayerLocation, float DeltaTime);
+	void ProcessAttack(APawn* Player, float DeltaTime);
+	void PromoteNearEntities(APawn* Player);
+	void DemoteFarEnemies(const FVector& PlayerLocation);
+	void UpdateRepresentation();
+
+	// Spawns the actor for a row, carries over its resources and AI state, and removes the row
+	AEnemyBase* PromoteRow(int32 Row, APawn* Player);
+
+	// Same eye-height line of sight as the actor perception traces
+	bool HasLineOfSight(int32 Row, const APawn* Player) const;
+
+	// Applies the batched damage computed for BatchRows, publishing hits and removing entities that die
+	int32 ApplyBatchedDamage(const FDamageInfo& DamageInfo);
+
+	void PublishEvent(ECombatEventType Type, int32 Row, const FDamageInfo& DamageInfo, float Amount) const;
+};
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/World.h"
+#include "UObject/ObjectKey.h"
+#include "EnemyPerceptionSubsystem.generated.h"
+
+class AEnemyBase;
+
+/**
+ * Cached line-of-sight state for one enemy
+ */
+enum class EEnemyVisibility : uint8
+{
+	Unknown,	// No trace has completed for the current target yet
+	Visible,
+	Blocked
+};
+
+/**
+ * Shared line-of-sight service for enemies
+ * Keeps one visibility record per enemy and refreshes the records that were queried recently,
+ * a budgeted number per frame, using async line traces. Callers read the cached result.
+ */
+UCLASS()
+class TRINITYFLOW_API UEnemyPerceptionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem implementation
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject implementation
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void Register(AEnemyBase* Enemy);
+	void Unregister(AEnemyBase* Enemy);
+
+	// Cached line of sight from the enemy's eyes to the target; keeps the record refreshing while queried.
+	// Results that went unrefreshed while nobody asked read as Unknown until the next trace lands.
+	EEnemyVisibility GetVisibility(AEnemyBase* Enemy, AActor* Target);
+
+	// Profiling counters
+	int32 GetTracesIssuedLastFrame() const { return TracesIssuedLastFrame; }
+	int32 GetNumRecords() const { return RecordIndices.Num(); }
+
+	// Offset applied to both trace ends (eye / chest height)
+	static constexpr float EyeHeight = 50.0f;
+
+private:
+	struct FVisibilityRecord
+	{
+		TWeakObjectPtr<AEnemyBase> Enemy;
+		TWeakObjectPtr<AActor> Target;
+		EEnemyVisibility Visibility = EEnemyVisibility::Unknown;
+		double LastRefreshTime = -1.0;
+		double LastQueryTime = -1.0;
+		FTraceHandle PendingTrace;
+		bool bInUse = false;
+	};
+
+	TArray<FVisibilityRecord> Records;
+	TArray<int32> FreeRecords;
+	TMap<TObjectKey<AEnemyBase>, int32> RecordIndices;
+
+	// Round-robin position so every record gets its turn under the budget
+	int32 RefreshCursor = 0;
+
+	int32 TracesIssuedLastFrame = 0;
+
+	FTraceDelegate TraceDelegate;
+
+	int32 FindOrAddRecord(AEnemyBase* Enemy);
+	void IssueTrace(int32 RecordIndex);
+	void OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	UFUNCTION()
+	void OnEnemyEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+};
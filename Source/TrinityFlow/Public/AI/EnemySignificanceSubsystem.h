@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Core/CombatEventBus.h"
+#include "EnemySignificanceSubsystem.generated.h"
+
+class AEnemyBase;
+
+/**
+ * How much game-thread time an enemy deserves
+ */
+enum class EEnemySignificance : uint8
+{
+	Near,		// In combat or close to the player: ticks every frame
+	Mid,		// Within sight range: 5 Hz
+	Far,		// Out of sight range but awake: 1 Hz
+	Dormant,	// Idle and far away: ticks disabled until woken
+
+	Count
+};
+
+/**
+ * Buckets enemies by distance and combat relevance and drives the tick rate of the enemy actor,
+ * its AI state machine and combat component accordingly.
+ * Damage events wake an enemy immediately; distance changes are picked up on the next evaluation.
+ */
+UCLASS()
+class TRINITYFLOW_API UEnemySignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem implementation
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject implementation
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void Register(AEnemyBase* Enemy);
+	void Unregister(AEnemyBase* Enemy);
+
+	// Forces an enemy to full tick rate until the next evaluation finds it insignificant again
+	void Wake(AEnemyBase* Enemy);
+
+	EEnemySignificance GetSignificance(const AEnemyBase* Enemy) const;
+	int32 GetNumInBucket(EEnemySignificance Significance) const { return BucketCounts[static_cast<int32>(Significance)]; }
+
+	// Distance thresholds (Mid uses each enemy's sight range)
+	static constexpr float NearDistance = 1500.0f;
+	static constexpr float FarWakeMargin = 500.0f;
+
+	// Seconds between re-bucketing passes
+	static constexpr float EvaluationInterval = 0.25f;
+
+private:
+	struct FSignificanceRecord
+	{
+		TWeakObjectPtr<AEnemyBase> Enemy;
+		TObjectKey<AEnemyBase> Key;
+		EEnemySignificance Significance = EEnemySignificance::Near;
+	};
+
+	TArray<FSignificanceRecord> Records;
+	TMap<TObjectKey<AEnemyBase>, int32> RecordIndices;
+	int32 BucketCounts[static_cast<int32>(EEnemySignificance::Count)] = {};
+
+	float TimeSinceEvaluation = 0.0f;
+
+	FDelegateHandle DamageEventHandle;
+
+	EEnemySignificance Evaluate(const AEnemyBase* Enemy, const FVector& PlayerLocation, bool bHasPlayer) const;
+	void Apply(FSignificanceRecord& Record, EEnemySignificance NewSignificance);
+	void RemoveRecord(int32 RecordIndex);
+
+	void OnDamageEvent(const FCombatEvent& Event);
+
+	UFUNCTION()
+	void OnEnemyEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+};
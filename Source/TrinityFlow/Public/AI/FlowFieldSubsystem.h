@@ -0,0 +1,125 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include <atomic>
+#include "FlowFieldSubsystem.generated.h"
+
+class ANavigationData;
+class UNavigationSystemV1;
+
+/**
+ * Coarse flow field toward the player shared by every chasing enemy
+ * A square grid of cells centred on the player holds the walking distance (in cells) to the
+ * player's cell. The integration pass re-runs only when the player crosses into another cell, and
+ * only while some chasing enemy has sampled the field recently. Cells are linked only where a navmesh
+ * raycast between their projected centres is clear, so walls and ledges thinner than a cell still
+ * split the field. Navmesh probes (projections and edge raycasts) are cached per world cell and height
+ * band, so moving the grid only probes the newly covered edge; cold builds are spread over frames
+ * under a probe budget while the previous field stays in use. The cache is dropped whenever the
+ * navigation system finishes a (re)build. Enemies sample a move direction in O(1) instead of pathfinding.
+ */
+UCLASS()
+class TRINITYFLOW_API UFlowFieldSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem implementation
+	virtual void Deinitialize() override;
+
+	// UWorldSubsystem implementation
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	// FTickableGameObject implementation
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Direction to move from Location toward the player; false outside coverage or when unreachable.
+	// Safe to call from the parallel decision step; calls keep the field being built.
+	bool GetFlowDirection(const FVector& Location, FVector& OutDirection) const;
+
+	bool HasField() const { return bHasField; }
+	bool IsBuilding() const { return bBuilding; }
+
+	// Profiling counters
+	int32 GetRebuildCount() const { return RebuildCount; }
+	int32 GetProbesLastRebuild() const { return ProbesLastRebuild; }
+	int32 GetFramesLastRebuild() const { return FramesLastRebuild; }
+	double GetLastRebuildMs() const { return LastRebuildMs; }
+
+	static constexpr float CellSize = 200.0f;
+	static constexpr int32 GridSize = 64;
+
+	// Height of a walkability cache band; stacked floors fall into different bands
+	static constexpr float ProbeBandHeight = 400.0f;
+
+	// Frames without a GetFlowDirection call after which the field stops rebuilding
+	static constexpr uint64 IdleFrames = 60;
+
+	// Integration cost of cells that cannot reach the player
+	static constexpr uint16 UnreachableCost = MAX_uint16;
+
+private:
+	// Navmesh results for one world cell and height band
+	struct FCellProbe
+	{
+		// Cell centre projected onto the navmesh
+		FVector NavPoint = FVector::ZeroVector;
+		bool bWalkable = false;
+
+		// Links to the +X (bit 0) and +Y (bit 1) neighbours; the -X/-Y links belong to those neighbours
+		uint8 EdgesProbed = 0;
+		uint8 EdgesOpen = 0;
+	};
+
+	// Published field: walking distance to the player's cell and the open links per cell (one bit per
+	// 4-neighbour), GridSize * GridSize, row-major from GridOrigin
+	TArray<uint16> Costs;
+	TArray<uint8> OpenEdges;
+
+	FIntPoint GridOrigin = FIntPoint::ZeroValue;
+	FIntPoint PlayerCell = FIntPoint::ZeroValue;
+	FVector PlayerLocation = FVector::ZeroVector;
+	bool bHasField = false;
+
+	// Field being integrated, published once its frontier is exhausted
+	TArray<uint16> BuildCosts;
+	TArray<uint8> BuildOpenEdges;
+	TArray<FIntPoint> BuildFrontier;
+	int32 BuildHead = 0;
+	FIntPoint BuildOrigin = FIntPoint::ZeroValue;
+	FIntPoint BuildPlayerCell = FIntPoint::ZeroValue;
+	float BuildProbeZ = 0.0f;
+	bool bBuilding = false;
+
+	int32 BuildProbes = 0;
+	int32 BuildFrames = 0;
+	double BuildMs = 0.0;
+	int32 ProbesThisFrame = 0;
+
+	// Navmesh probes per world cell and height band (Z); survive grid moves
+	TMap<FIntVector, FCellProbe> ProbeCache;
+
+	// Frame of the last GetFlowDirection call; written from decision worker threads
+	mutable std::atomic<uint64> LastQueryFrame{ 0 };
+
+	int32 RebuildCount = 0;
+	int32 ProbesLastRebuild = 0;
+	int32 FramesLastRebuild = 0;
+	double LastRebuildMs = 0.0;
+
+	static FIntPoint WorldToCell(const FVector& Location);
+	static FIntVector MakeProbeKey(const FIntPoint& Cell, float ProbeZ);
+	static int32 GetCellIndex(const FIntPoint& Cell, const FIntPoint& Origin);
+
+	FCellProbe ProbeCell(UNavigationSystemV1& NavSys, const FIntPoint& Cell, float ProbeZ);
+	bool IsEdgeOpen(UNavigationSystemV1& NavSys, const FIntPoint& Cell, const FIntPoint& Offset, float ProbeZ);
+
+	void BeginBuild(const FVector& NewPlayerLocation);
+	void ContinueBuild();
+
+	// Navmesh changed, so cached probes are stale
+	UFUNCTION()
+	void OnNavigationGenerationFinished(ANavigationData* NavData);
+};
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "NavigationSystemTypes.h"
+#include "PathRequestScheduler.generated.h"
+
+class AEnemyBase;
+class AEnemyAIController;
+
+/**
+ * Queues chase path refreshes and dispatches them within a per-frame game thread budget
+ * Requests are coalesced per enemy and ordered by staleness and distance to the goal, so a pack
+ * that starts chasing in the same frame spreads its pathfinding over the following frames.
+ * Paths are found with FindPathAsync and handed to the controller's path following on completion.
+ * An enemy has at most one query in flight; a newer request waits in the queue until that result is
+ * in, so a slow query can never overwrite a newer path. The budget only covers building and issuing
+ * queries on the game thread; the async search time itself is not counted.
+ * While UCombatReplaySubsystem is recording or replaying, the wall-clock budget and async queries
+ * would make enemy movement differ between runs; the scheduler then dispatches a fixed number of
+ * requests per frame and finds each path synchronously, applying it on the frame it was dispatched.
+ */
+UCLASS()
+class TRINITYFLOW_API UPathRequestScheduler : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem implementation
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject implementation
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Queue a path to Goal; replaces any request still waiting for this enemy
+	void RequestPath(AEnemyBase* Enemy, AActor* Goal, float AcceptanceRadius);
+
+	// Drops queued and in-flight requests for this enemy (results that arrive later are ignored)
+	void CancelRequests(AEnemyBase* Enemy);
+
+	// Profiling counters
+	int32 GetQueueDepth() const { return Queue.Num(); }
+	int32 GetNumInFlight() const { return InFlight.Num(); }
+	int32 GetDispatchedLastFrame() const { return DispatchedLastFrame; }
+
+	// Game thread time spent dispatching last frame, excluding the async searches
+	double GetDispatchMsLastFrame() const { return DispatchMsLastFrame; }
+
+	// Moving average of the time from request to path applied
+	double GetAverageLatencyMs() const { return AverageLatencyMs; }
+
+	// One second of waiting outranks this much extra distance
+	static constexpr float StalenessWeight = 1000.0f;
+
+private:
+	struct FPathRequest
+	{
+		TWeakObjectPtr<AEnemyBase> Enemy;
+		TObjectKey<AEnemyBase> Key;
+		TWeakObjectPtr<AActor> Goal;
+		float AcceptanceRadius = 0.0f;
+		double RequestTime = 0.0;
+		float Priority = 0.0f;
+	};
+
+	TArray<FPathRequest> Queue;
+	TMap<TObjectKey<AEnemyBase>, int32> QueueIndices;
+
+	// Async queries keyed by nav query id, and the query each enemy is waiting on
+	TMap<uint32, FPathRequest> InFlight;
+	TMap<TObjectKey<AEnemyBase>, uint32> InFlightQueries;
+
+	FNavPathQueryDelegate PathQueryDelegate;
+
+	int32 DispatchedLastFrame = 0;
+	double DispatchMsLastFrame = 0.0;
+	double AverageLatencyMs = 0.0;
+
+	bool Dispatch(const FPathRequest& Request, bool bSynchronous);
+	void RecordLatency(const FPathRequest& Request);
+
+	// Starts path following on a found path, as AAIController::MoveTo does for its own queries
+	static void ApplyPath(const FPathRequest& Request, AEnemyAIController* Controller, FNavPathSharedPtr Path);
+
+	void OnPathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path);
+};
@@ -13,7 +13,8 @@ public:
 	UAIState_Attack();
 
 	virtual void Enter(AEnemyBase* Enemy, AEnemyAIController* AIController) override;
-	virtual void Update(float DeltaTime) override;
+	virtual void Evaluate(const FAIStateSnapshot& Snapshot, FAIStateDecision& OutDecision) override;
+	virtual void Apply(const FAIStateSnapshot& Snapshot, const FAIStateDecision& Decision) override;
 	virtual void Exit() override;
 
 protected:
@@ -34,5 +35,4 @@ private:
 	bool bIsAttacking;
 	
 	void PerformAttack();
-	bool IsTargetInRange();
 };
\ No newline at end of file
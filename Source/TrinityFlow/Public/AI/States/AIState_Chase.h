@@ -13,7 +13,8 @@ public:
 	UAIState_Chase();
 
 	virtual void Enter(AEnemyBase* Enemy, AEnemyAIController* AIController) override;
-	virtual void Update(float DeltaTime) override;
+	virtual void Evaluate(const FAIStateSnapshot& Snapshot, FAIStateDecision& OutDecision) override;
+	virtual void Apply(const FAIStateSnapshot& Snapshot, const FAIStateDecision& Decision) override;
 	virtual void Exit() override;
 
 protected:
@@ -34,8 +35,10 @@ protected:
 
 private:
 	float TimeSinceLastPathUpdate;
+
+	// Steering from the shared flow field instead of a navmesh path
+	bool bFollowingFlowField = false;
 	
 	void UpdatePath();
-	bool IsInAttackRange();
-	bool HasLostTarget();
+	bool SampleFlowField(FVector& OutDirection) const;
 };
\ No newline at end of file
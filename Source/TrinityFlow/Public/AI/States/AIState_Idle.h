@@ -13,7 +13,8 @@ public:
 	UAIState_Idle();
 
 	virtual void Enter(AEnemyBase* Enemy, AEnemyAIController* AIController) override;
-	virtual void Update(float DeltaTime) override;
+	virtual void Evaluate(const FAIStateSnapshot& Snapshot, FAIStateDecision& OutDecision) override;
+	virtual void Apply(const FAIStateSnapshot& Snapshot, const FAIStateDecision& Decision) override;
 	virtual void Exit() override;
 
 protected:
@@ -25,6 +26,7 @@ protected:
 
 private:
 	float TimeSinceLastCheck;
-	
-	bool CheckForPlayer();
+
+	// Set by Evaluate when this frame's detection check found the player within sight range
+	bool bDetectionCheckInRange = false;
 };
\ No newline at end of file
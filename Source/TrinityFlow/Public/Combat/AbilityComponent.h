@@ -10,11 +10,9 @@ struct FEchoesData
 {
     GENERATED_BODY()
 
+    // The mark itself (and its expiry) is the target's Marked row in UStatusEffectSubsystem
     UPROPERTY()
     AActor* MarkedEnemy = nullptr;
-
-    UPROPERTY()
-    float RemainingTime = 0.0f;
 };
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
@@ -25,13 +23,15 @@ class TRINITYFLOW_API UAbilityComponent : public UActorComponent
 public:
     UAbilityComponent();
 
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-
     UFUNCTION()
     void SetEchoesTarget(AActor* Target);
 
+    // Null once the mark has expired
     UFUNCTION()
-    AActor* GetEchoesTarget() const { return EchoesData.MarkedEnemy; }
+    AActor* GetEchoesTarget() const;
+
+    UFUNCTION()
+    float GetEchoesTimeRemaining() const;
 
     UFUNCTION()
     void OnDamageDealt(AActor* DamagedActor, const FDamageInfo& DamageInfo);
@@ -46,4 +46,8 @@ protected:
     void ProcessEchoesDamage(AActor* DamagedActor, const FDamageInfo& DamageInfo);
     
     void ProcessEchoesDamageActual(AActor* DamagedActor, float ActualDamage, AActor* DamageInstigator);
+
+    bool IsEchoesMarkActive() const;
+
+    static constexpr float EchoesMarkDuration = 5.0f;
 };
\ No newline at end of file
@@ -3,8 +3,11 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Core/TrinityFlowTypes.h"
+#include "Core/CombatTimerSubsystem.h"
 #include "WeaponBase.generated.h"
 
+struct FHordeEntityId;
+
 UCLASS(Abstract)
 class TRINITYFLOW_API AWeaponBase : public AActor
 {
@@ -36,22 +39,20 @@ public:
     virtual void DefensiveAbility() { }
 
     UFUNCTION()
-    bool IsAbilityQReady() const { return AbilityQCooldownTimer <= 0.0f; }
+    bool IsAbilityQReady() const;
 
     UFUNCTION()
-    bool IsAbilityEReady() const { return AbilityECooldownTimer <= 0.0f; }
+    bool IsAbilityEReady() const;
 
     UFUNCTION()
-    float GetAbilityQCooldownRemaining() const { return AbilityQCooldownTimer; }
+    float GetAbilityQCooldownRemaining() const;
 
     UFUNCTION()
-    float GetAbilityECooldownRemaining() const { return AbilityECooldownTimer; }
+    float GetAbilityECooldownRemaining() const;
 
     UFUNCTION()
     float GetAttackDuration() const { return BasicAttackDamageDelay + 0.5f; } // Attack time + recovery
 
-    virtual void Tick(float DeltaTime) override;
-
 protected:
     UPROPERTY()
     class USceneComponent* Root;
@@ -71,14 +72,13 @@ protected:
     UPROPERTY()
     float AbilityQCooldown = 5.0f;
 
-    UPROPERTY()
-    float AbilityQCooldownTimer = 0.0f;
+    // Cooldown expiries live in the combat timer wheel, so the base weapon does not tick
+    FCombatTimerHandle AbilityQCooldownHandle;
 
     UPROPERTY()
     float AbilityECooldown = 6.0f;
 
-    UPROPERTY()
-    float AbilityECooldownTimer = 0.0f;
+    FCombatTimerHandle AbilityECooldownHandle;
 
     UPROPERTY()
     class APawn* OwnerPawn;
@@ -100,5 +100,19 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category = "Weapon")
     bool bIsLeftHandWeapon = false;
 
-    void StartCooldown(float& Timer, float Cooldown);
+    // Half angle of the cone in front of the owner's aim that basic attacks search for horde entities
+    static constexpr float HordeAttackHalfAngle = 45.0f;
+
+    void StartCooldown(FCombatTimerHandle& Handle, float Cooldown);
+    void ResetCooldown(FCombatTimerHandle& Handle);
+
+    // Outgoing damage of this weapon's attacks with shard bonuses and stance modifiers folded in
+    FDamageInfo MakeAttackDamage(EDamageType DamageType) const;
+
+    // Basic attack against entities that are still in the horde (no actor to trace against)
+    void BasicAttackHorde();
+    void ExecuteHordeAttack(FHordeEntityId Entity);
+
+    // Hits a horde entity that is still within MaxRange; every weapon and ability hit on the horde goes here
+    bool HitHordeEntity(FHordeEntityId Entity, EDamageType DamageType, float MaxRange, const FColor& DebugColor);
 };
\ No newline at end of file
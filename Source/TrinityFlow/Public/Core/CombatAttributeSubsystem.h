@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Core/TrinityFlowTypes.h"
+#include "CombatAttributeSubsystem.generated.h"
+
+class UActorComponent;
+
+/**
+ * Final combat stats of one actor, aggregated from every source that modifies them
+ * Outgoing damage folds base attack, shard bonuses and stance modifiers together; the incoming side
+ * keeps defence and the tag mask the damage calculator resolves tag effects and cached responses from.
+ */
+struct FCombatAttributes
+{
+    static constexpr int32 NumDamageTypes = 2;
+
+    // Damage of a basic hit per EDamageType before the target's response
+    float OutgoingDamage[NumDamageTypes] = { 0.0f, 0.0f };
+
+    float Defence = 0.0f;
+    ECharacterTag DamageTags = ECharacterTag::None;
+
+    float GetOutgoingDamage(EDamageType Type) const { return OutgoingDamage[static_cast<uint8>(Type)]; }
+};
+
+/**
+ * Per-world cache of FCombatAttributes keyed by actor
+ * Values are rebuilt lazily on the first read after a source changed: health resources (e.g. counter
+ * attacks lowering defence), shard activation, stance changes and tag changes. Tag effects are not
+ * cached here; the damage calculator resolves them from the tag mask against the active tag table.
+ * The hit path reads the cached numbers instead of walking components and shard maps per hit.
+ */
+UCLASS()
+class TRINITYFLOW_API UCombatAttributeSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    // Cached attributes, recomputed first if dirty; the reference is only valid until the next lookup
+    const FCombatAttributes& Find(const AActor* Actor);
+
+    // Flags the actor's attributes for recomputation on the next read
+    void MarkDirty(const AActor* Actor);
+
+    // Convenience lookup through the actor's world; returns default attributes for null actors
+    static const FCombatAttributes& Get(const AActor* Actor);
+
+    // Damage of an attack by Instigator before the target's response; every attack, on actors and horde
+    // entities alike, takes its amount from here
+    static FDamageInfo MakeAttackDamage(AActor* Instigator, EDamageType Type);
+
+    // Called by attribute sources (health, shard, stance and tag components) when their values change
+    static void NotifySourceChanged(const UActorComponent* Source);
+
+    // Profiling counters
+    int32 GetNumCached() const { return Entries.Num(); }
+    uint64 GetLookups() const { return Lookups; }
+    uint64 GetRecomputes() const { return Recomputes; }
+
+private:
+    struct FAttributeEntry
+    {
+        FCombatAttributes Attributes;
+        bool bDirty = true;
+    };
+
+    TMap<TObjectKey<AActor>, FAttributeEntry> Entries;
+
+    // Used for actors that are not playing so they are not cached
+    FCombatAttributes TransientAttributes;
+
+    uint64 Lookups = 0;
+    uint64 Recomputes = 0;
+
+    static void Compute(const AActor* Actor, FCombatAttributes& OutAttributes);
+
+    UFUNCTION()
+    void OnActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+};
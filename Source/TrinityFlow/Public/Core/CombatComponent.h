@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "TrinityFlowTypes.h"
+#include "Core/CombatTimerSubsystem.h"
 #include "CombatComponent.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAttack);
@@ -25,7 +26,7 @@ public:
     void StartAttack(AActor* Target, float Range, EDamageType DamageType, bool bIsAreaDamage = false);
 
     UFUNCTION()
-    float GetAttackCooldownRemaining() const { return AttackCooldownTimer; }
+    float GetAttackCooldownRemaining() const;
 
     UFUNCTION()
     void SetAttackSpeed(float AttacksPerSecond);
@@ -43,12 +44,15 @@ protected:
     UPROPERTY()
     float AttackCooldown = 1.5f;
 
-    UPROPERTY()
-    float AttackCooldownTimer = 0.0f;
+    // Cooldown expiry lives in the combat timer wheel; the component only ticks while casting
+    FCombatTimerHandle AttackCooldownHandle;
 
     UPROPERTY()
     float AttackRange = 300.0f;
 
+    UPROPERTY()
+    float AreaDamageRadius = 400.0f;
+
     UPROPERTY()
     float CastingTime = 1.5f;
 
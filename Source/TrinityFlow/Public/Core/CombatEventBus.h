@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Delegates/Delegate.h"
+#include "TrinityFlowTypes.h"
+
+class AActor;
+
+/**
+ * Kinds of combat events published on the bus
+ */
+enum class ECombatEventType : uint8
+{
+    DamageDealt,
+    Death,
+
+    Count
+};
+
+/**
+ * A single combat event
+ * Actor pointers are only guaranteed valid during the frame the event was published in.
+ * Target is null for combatants without an actor (horde entities); Location is always set.
+ */
+struct FCombatEvent
+{
+    ECombatEventType Type = ECombatEventType::DamageDealt;
+    AActor* Target = nullptr;
+    AActor* Instigator = nullptr;
+    FVector Location = FVector::ZeroVector;
+    float Amount = 0.0f;
+    EDamageType DamageType = EDamageType::Physical;
+    bool bIsLeftWeapon = false;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnCombatEvent, const FCombatEvent&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnCombatEventBatch, TArrayView<const FCombatEvent>);
+
+/**
+ * World-level combat event dispatch with native listeners, subscribed per event type
+ * Immediate listeners run inside Publish (gameplay reactions such as echo damage).
+ * Batched listeners receive everything published since the last Flush in one call (UI).
+ */
+class TRINITYFLOW_API FCombatEventBus
+{
+public:
+    FDelegateHandle Subscribe(ECombatEventType Type, FOnCombatEvent::FDelegate&& Listener);
+    FDelegateHandle SubscribeBatched(ECombatEventType Type, FOnCombatEventBatch::FDelegate&& Listener);
+    void Unsubscribe(ECombatEventType Type, FDelegateHandle Handle);
+
+    void Publish(const FCombatEvent& Event);
+
+    // Delivers queued events to batched listeners
+    void Flush();
+
+    void Reset();
+
+private:
+    static constexpr int32 NumEventTypes = static_cast<int32>(ECombatEventType::Count);
+
+    FOnCombatEvent Listeners[NumEventTypes];
+    FOnCombatEventBatch BatchListeners[NumEventTypes];
+    TArray<FCombatEvent> QueuedEvents[NumEventTypes];
+
+    // Swapped with QueuedEvents during Flush so listeners may publish again
+    TArray<FCombatEvent> FlushingEvents;
+};
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include <atomic>
+
+// The recorder is a development tool; shipping builds compile every TRINITYFLOW_RECORD_COMBAT call away
+#ifndef TRINITYFLOW_WITH_COMBAT_RECORDER
+#define TRINITYFLOW_WITH_COMBAT_RECORDER !UE_BUILD_SHIPPING
+#endif
+
+class FRunnableThread;
+class FArchive;
+
+enum class ECombatRecordType : uint8
+{
+    AttackExecuted,     // Source weapon owner, Target victim, Value0 raw damage, Param left weapon
+    DamageApplied,      // Source instigator, Target victim, Value0 final damage, Value1 raw damage, Param EDamageType
+    EchoDamage,         // Source instigator, Target marked enemy, Value0 echo damage, Value1 triggering damage
+    Death,              // Target the actor that died
+    PathRequested,      // Source enemy, Target goal, Value0 acceptance radius
+    PathCompleted,      // Source enemy, Target goal, Value0 latency ms, Param ENavigationQueryResult
+    Count
+};
+
+/** One fixed-size combat event as pushed by gameplay code */
+struct FCombatRecord
+{
+    uint64 TimeMicros = 0;
+    uint32 Frame = 0;
+    uint32 SourceId = 0;
+    uint32 TargetId = 0;
+    float Values[2] = { 0.0f, 0.0f };
+    ECombatRecordType Type = ECombatRecordType::AttackExecuted;
+    uint8 Param = 0;
+};
+
+/**
+ * Delta encoding for recording files
+ * A file is a header (magic, version, start time) followed by records. Each record is its type and
+ * param bytes, varint deltas of time and frame against the previous record, zigzag varint deltas of
+ * the two actor ids and the two raw floats.
+ */
+struct TRINITYFLOW_API FCombatRecordCodec
+{
+    static constexpr uint32 FileMagic = 0x52434654; // "TFCR"
+    static constexpr uint32 FileVersion = 1;
+
+    static void WriteHeader(TArray<uint8>& Out, int64 StartTicks);
+    static bool ReadHeader(const uint8*& Cursor, const uint8* End, int64& OutStartTicks);
+
+    static void Encode(const FCombatRecord& Record, FCombatRecord& Previous, TArray<uint8>& Out);
+    static bool Decode(const uint8*& Cursor, const uint8* End, FCombatRecord& Previous, FCombatRecord& OutRecord);
+
+    static const TCHAR* GetTypeName(ECombatRecordType Type);
+};
+
+/**
+ * Binary combat event recorder
+ * Gameplay threads push records into a bounded lock-free ring; a worker thread drains it and writes
+ * delta-encoded records to Saved/CombatRecordings. When the ring is full new records are dropped and
+ * counted rather than blocking the game. Decode recordings with `-run=CombatRecording -File=<path>`.
+ */
+class TRINITYFLOW_API FCombatEventRecorder : public FRunnable
+{
+public:
+    static FCombatEventRecorder& Get();
+
+    // Cheap enough to call unconditionally: a single atomic load when not recording
+    static void Record(ECombatRecordType Type, const UObject* Source, const UObject* Target,
+        float Value0 = 0.0f, float Value1 = 0.0f, uint8 Param = 0);
+
+    bool Start();
+    void Stop();
+    bool IsRecording() const { return bRecording.load(std::memory_order_relaxed); }
+
+    const FString& GetFilename() const { return Filename; }
+    uint64 GetNumRecorded() const { return NumRecorded.load(std::memory_order_relaxed); }
+    uint64 GetNumDropped() const { return NumDropped.load(std::memory_order_relaxed); }
+    int64 GetBytesWritten() const { return BytesWritten.load(std::memory_order_relaxed); }
+
+    //~ Begin FRunnable
+    virtual uint32 Run() override;
+    //~ End FRunnable
+
+    virtual ~FCombatEventRecorder();
+
+private:
+    FCombatEventRecorder();
+
+    bool Push(const FCombatRecord& Record);
+    bool Pop(FCombatRecord& OutRecord);
+    void Drain();
+
+    static constexpr uint32 Capacity = 1 << 14;
+    static constexpr uint32 IndexMask = Capacity - 1;
+
+    // Bounded multi-producer/single-consumer ring; each slot's sequence says whose turn it is
+    struct FSlot
+    {
+        std::atomic<uint32> Sequence{ 0 };
+        FCombatRecord Record;
+    };
+
+    TUniquePtr<FSlot[]> Slots;
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> EnqueuePosition{ 0 };
+    alignas(PLATFORM_CACHE_LINE_SIZE) uint32 DequeuePosition = 0;
+
+    std::atomic<bool> bRecording{ false };
+    std::atomic<bool> bStopRequested{ false };
+    std::atomic<uint64> NumRecorded{ 0 };
+    std::atomic<uint64> NumDropped{ 0 };
+    std::atomic<int64> BytesWritten{ 0 };
+
+    // Owned by the worker thread while recording
+    FRunnableThread* Thread = nullptr;
+    TUniquePtr<FArchive> Writer;
+    FCombatRecord PreviousRecord;
+    TArray<uint8> EncodeBuffer;
+
+    FString Filename;
+    double StartSeconds = 0.0;
+};
+
+#if TRINITYFLOW_WITH_COMBAT_RECORDER
+#define TRINITYFLOW_RECORD_COMBAT(Type, Source, Target, ...) \
+    FCombatEventRecorder::Record(ECombatRecordType::Type, Source, Target, ##__VA_ARGS__)
+#else
+#define TRINITYFLOW_RECORD_COMBAT(Type, Source, Target, ...)
+#endif
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CombatRecordingCommandlet.generated.h"
+
+/**
+ * Decodes a binary combat recording written by FCombatEventRecorder
+ * Usage: -run=CombatRecording -File=<path.tfrec> [-Csv=<out.csv>] [-Summary]
+ * Logs one line per record (or writes a CSV) followed by per-type counts and totals.
+ */
+UCLASS()
+class TRINITYFLOW_API UCombatRecordingCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UCombatRecordingCommandlet();
+
+    //~ Begin UCommandlet
+    virtual int32 Main(const FString& Params) override;
+    //~ End UCommandlet
+};
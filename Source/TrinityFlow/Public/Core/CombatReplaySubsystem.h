@@ -0,0 +1,136 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "CombatReplaySubsystem.generated.h"
+
+// Player inputs that go through the replay layer; the order is part of the file format
+enum class EReplayInputAction : uint8
+{
+    Move,
+    Look,
+    LeftAttack,
+    RightAttack,
+    AbilityQ,
+    AbilityE,
+    AbilityTab,
+    AbilityR,
+    LeftDefensive,
+    RightDefensive,
+    StopJumping,
+    Count
+};
+
+DECLARE_DELEGATE_TwoParams(FOnReplayInput, EReplayInputAction, FVector2D);
+
+/**
+ * Deterministic input recording and replay for performance regression runs
+ * `-CombatRecord[=Name]` records player inputs, spawner events and the gameplay RNG seed from the
+ * first frame of the map at a fixed timestep. `-CombatReplay=<file>` loads the map's recording and
+ * feeds the inputs back on the same frames (works headless with `-nullrhi`); at the end it writes a
+ * per-frame timing CSV and compares the final state hash with the recording. `-CombatReplayExit`
+ * quits once the replay is done. Systems that budget work by wall clock or finish it asynchronously
+ * (such as UPathRequestScheduler) switch to fixed per-frame work while IsRecording/IsReplaying.
+ */
+UCLASS()
+class TRINITYFLOW_API UCombatReplaySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem implementation
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // UWorldSubsystem implementation
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+    static UCombatReplaySubsystem* Get(const UObject* WorldContextObject);
+
+    // Gameplay randomness that has to match between recording and replay; falls back to an unseeded stream without a world
+    static FRandomStream& GetRandomStream(const UObject* WorldContextObject);
+
+    bool StartRecording(const FString& Name);
+    // Ends the recording at the start of the next frame, the same point a replay of it ends
+    void StopRecording();
+    bool StartReplay(const FString& Filename);
+
+    bool IsRecording() const { return Mode == EMode::Recording; }
+    bool IsReplaying() const { return Mode == EMode::Replaying; }
+
+    // The local player character routes live input through RecordInput and receives replayed input through the sink
+    void SetInputSink(FOnReplayInput InSink) { InputSink = MoveTemp(InSink); }
+    void RecordInput(EReplayInputAction Action, FVector2D Value);
+    void RecordSpawn(uint8 EnemyType, int32 Count, const FVector& Location);
+
+    uint32 GetFrameIndex() const { return FrameIndex; }
+    uint32 ComputeStateHash() const;
+
+private:
+    enum class EMode : uint8
+    {
+        Idle,
+        Recording,
+        Replaying
+    };
+
+    struct FReplayInputEvent
+    {
+        uint32 Frame = 0;
+        EReplayInputAction Action = EReplayInputAction::Move;
+        FVector2f Value = FVector2f::ZeroVector;
+    };
+
+    struct FReplaySpawnEvent
+    {
+        uint32 Frame = 0;
+        uint8 EnemyType = 0;
+        int32 Count = 0;
+        FVector3f Location = FVector3f::ZeroVector;
+    };
+
+    void OnWorldPreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+    void FinishRecording();
+    void FinishReplay();
+
+    void BeginFixedStep();
+    void EndFixedStep();
+
+    bool SaveRecording();
+    bool LoadRecording(const FString& InFilename);
+    void SerializeEvents(FArchive& Ar);
+
+    static bool IsAxisAction(EReplayInputAction Action);
+
+    EMode Mode = EMode::Idle;
+    FRandomStream RandomStream;
+    FOnReplayInput InputSink;
+    FDelegateHandle PreActorTickHandle;
+
+    FString Filename;
+    FString RecordedMapName;
+    int32 Seed = 0;
+    float FixedDeltaTime = 1.0f / 60.0f;
+    uint32 NumFrames = 0;
+    uint32 RecordedStateHash = 0;
+
+    TArray<FReplayInputEvent> InputEvents;
+    TArray<FReplaySpawnEvent> SpawnEvents;
+
+    // Playback cursors
+    uint32 FrameIndex = 0;
+    int32 NextInputEvent = 0;
+    int32 NextSpawnEvent = 0;
+    int32 Desyncs = 0;
+    bool bStopRecordingRequested = false;
+    bool bExitWhenDone = false;
+
+    // Timing of each replayed frame: wall clock and game thread milliseconds
+    TArray<FVector2f> FrameTimings;
+    double LastFrameStartSeconds = 0.0;
+
+    bool bSavedUseFixedTimeStep = false;
+    double SavedFixedDeltaTime = 0.0;
+};
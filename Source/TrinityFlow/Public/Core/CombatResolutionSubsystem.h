@@ -0,0 +1,107 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TrinityFlowTypes.h"
+#include "DamageCalculator.h"
+#include "CombatEventBus.h"
+#include "CombatResolutionSubsystem.generated.h"
+
+class UHealthComponent;
+
+/**
+ * A single queued hit waiting for the resolution phase
+ */
+struct FDamageRequest
+{
+    TWeakObjectPtr<UHealthComponent> Target;
+    FDamageInfo DamageInfo;
+    FVector DamageDirection = FVector::ZeroVector;
+
+    FDamageRequest() {}
+
+    FDamageRequest(UHealthComponent* InTarget, const FDamageInfo& InDamageInfo, const FVector& InDamageDirection)
+        : Target(InTarget), DamageInfo(InDamageInfo), DamageDirection(InDamageDirection) {}
+};
+
+/**
+ * Damage dealt to one target by one instigator with one damage type,
+ * summed over every hit resolved for that target in the current pass
+ */
+struct FResolvedDamageEvent
+{
+    AActor* Instigator = nullptr;
+    EDamageType Type = EDamageType::Physical;
+    float ActualDamage = 0.0f;
+    bool bIsLeftWeapon = false;
+};
+
+/**
+ * Per-frame damage resolution
+ * Collects every FDamageInfo submitted during the frame and resolves them in one
+ * deterministic phase after actor, component and timer ticks have run.
+ * Events are coalesced per target: one OnHealthChanged, one hit reaction and one
+ * OnDamageDealt per (instigator, damage type) pair.
+ * Owns the world's FCombatEventBus; batched listeners are flushed after each resolution phase.
+ */
+UCLASS()
+class TRINITYFLOW_API UCombatResolutionSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem implementation
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject implementation
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // Queue a hit for resolution at the end of the frame
+    void SubmitDamage(UHealthComponent* Target, const FDamageInfo& DamageInfo, const FVector& DamageDirection);
+
+    // Resolve everything queued so far (normally called from Tick)
+    void ResolvePendingDamage();
+
+    bool IsResolving() const { return bIsResolving; }
+
+    FCombatEventBus& GetEventBus() { return EventBus; }
+
+    // Event bus of the actor's world, null if the world has no resolution subsystem
+    static FCombatEventBus* GetEventBus(const UObject* WorldContextObject);
+
+    // Profiling counters for the last resolution phase
+    int32 GetRequestsResolvedLastFrame() const { return RequestsResolvedLastFrame; }
+    int32 GetTargetsResolvedLastFrame() const { return TargetsResolvedLastFrame; }
+    int32 GetPassesLastFrame() const { return PassesLastFrame; }
+
+    // Memoized per-archetype damage responses, used by the batch kernel when TrinityFlow.Damage.ResponseCache is on
+    const FDamageResponseCache& GetDamageResponseCache() const { return DamageResponseCache; }
+
+private:
+    // Requests submitted since the last resolution pass
+    TArray<FDamageRequest> PendingRequests;
+
+    // Scratch buffers reused every pass to avoid per-frame allocations
+    TArray<FDamageRequest> ResolvingRequests;
+    TArray<int32> BatchRequestIndices;
+    FDamageBatch DamageBatch;
+    TArray<float> BatchDamage;
+    FDamageResponseCache DamageResponseCache;
+    FCombatEventBus EventBus;
+    TArray<UHealthComponent*> TargetOrder;
+    TMap<UHealthComponent*, int32> TargetIndices;
+    TArray<TArray<FResolvedDamageEvent>> TargetEvents;
+
+    bool bIsResolving = false;
+
+    int32 RequestsResolvedLastFrame = 0;
+    int32 TargetsResolvedLastFrame = 0;
+    int32 PassesLastFrame = 0;
+
+    // Echo damage can queue follow-up hits while resolving; cap the chain length
+    static constexpr int32 MaxResolvePasses = 8;
+
+    void ResolvePass();
+};
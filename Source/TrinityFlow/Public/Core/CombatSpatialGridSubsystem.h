@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "CombatSpatialGridSubsystem.generated.h"
+
+class USceneComponent;
+
+/**
+ * Uniform hash grid (XY) over every registered combatant
+ * Entries move between cells from their root component's transform updates, so queries never
+ * touch the physics scene. Queries test against the combatant's collision radius, matching what
+ * a sphere overlap against pawn capsules would return.
+ */
+UCLASS()
+class TRINITYFLOW_API UCombatSpatialGridSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    void Register(AActor* Actor);
+    void Unregister(AActor* Actor);
+
+    bool IsRegistered(const AActor* Actor) const { return EntryIndices.Contains(Actor); }
+    int32 Num() const { return EntryIndices.Num(); }
+
+    // Combatants whose collision radius overlaps the sphere
+    void QueryRadius(const FVector& Center, float Radius, TArray<AActor*>& OutActors, const AActor* IgnoreActor = nullptr) const;
+
+    // Combatants within Radius whose direction from Origin is within HalfAngleDegrees of Direction
+    void QueryCone(const FVector& Origin, const FVector& Direction, float Radius, float HalfAngleDegrees, TArray<AActor*>& OutActors, const AActor* IgnoreActor = nullptr) const;
+
+    // Up to Count combatants nearest to Location (closest first), no further than MaxRadius
+    void QueryNearest(const FVector& Location, int32 Count, float MaxRadius, TArray<AActor*>& OutActors, const AActor* IgnoreActor = nullptr) const;
+
+    // Defaults to the area damage radius so most queries touch at most four cells
+    static constexpr float CellSize = 400.0f;
+
+private:
+    struct FGridEntry
+    {
+        TWeakObjectPtr<AActor> Actor;
+        FVector Location = FVector::ZeroVector;
+        float Radius = 0.0f;
+        FIntPoint Cell = FIntPoint::ZeroValue;
+        FDelegateHandle TransformHandle;
+        bool bInUse = false;
+    };
+
+    TArray<FGridEntry> Entries;
+    TArray<int32> FreeEntries;
+    TMap<TObjectKey<AActor>, int32> EntryIndices;
+    TMap<FIntPoint, TArray<int32>> Cells;
+
+    // Largest collision radius registered so far; widens the cell scan of radius queries
+    float MaxEntryRadius = 0.0f;
+
+    static FIntPoint GetCell(const FVector& Location);
+
+    void MoveEntry(int32 EntryIndex, const FVector& NewLocation);
+    void RemoveFromCell(int32 EntryIndex);
+
+    void OnTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+    UFUNCTION()
+    void OnActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
+    // Calls Visitor(Actor, Location) for every live entry overlapping the sphere
+    template<typename VisitorType>
+    void ForEachInRadius(const FVector& Center, float Radius, const AActor* IgnoreActor, VisitorType&& Visitor) const;
+};
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CombatTimerSubsystem.generated.h"
+
+/** Identifies one timer in UCombatTimerSubsystem; stale once the timer fires or is cleared */
+struct FCombatTimerHandle
+{
+    int32 Index = INDEX_NONE;
+    uint32 Serial = 0;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+    void Invalidate() { Index = INDEX_NONE; Serial = 0; }
+};
+
+/**
+ * Cooldowns and timed states for every combatant, kept in one hierarchical timing wheel
+ * Timers store their absolute expiry in game time, so components no longer tick to count floats
+ * down and remaining time is computed only when someone asks (e.g. the HUD). Expiries are bucketed
+ * into 256 near slots of one 60 Hz frame each, 64 far slots of 256 frames each, and an overflow
+ * list; each frame only visits the slots game time has passed.
+ */
+UCLASS()
+class TRINITYFLOW_API UCombatTimerSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem implementation
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject implementation
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // Convenience lookup through the object's world; null without a world
+    static UCombatTimerSubsystem* Get(const UObject* WorldContextObject);
+
+    // Calls Callback (if bound) once Duration seconds of game time have passed, replacing the timer in Handle
+    void SetTimer(FCombatTimerHandle& Handle, float Duration, FSimpleDelegate Callback = FSimpleDelegate());
+
+    void ClearTimer(FCombatTimerHandle& Handle);
+
+    bool IsTimerActive(const FCombatTimerHandle& Handle) const;
+
+    // Seconds until the timer fires; 0 for fired or cleared timers
+    float GetTimeRemaining(const FCombatTimerHandle& Handle) const;
+
+    // Profiling counters
+    int32 GetNumActiveTimers() const { return NumActiveTimers; }
+    int32 GetNumTimerRecords() const { return ExpiryTimes.Num(); }
+    int32 GetFiredLastFrame() const { return FiredLastFrame; }
+    int32 GetSlotsVisitedLastFrame() const { return SlotsVisitedLastFrame; }
+
+    static constexpr double SlotDuration = 1.0 / 60.0;
+    static constexpr int32 NearSlotBits = 8;
+    static constexpr int32 NumNearSlots = 1 << NearSlotBits;
+    static constexpr int32 NumFarSlots = 64;
+
+private:
+    struct FWheelEntry
+    {
+        int32 Index = INDEX_NONE;
+        uint32 Serial = 0;
+    };
+
+    // Timer records, indexed by handle; freed records are reused and their serial bumped
+    TArray<double> ExpiryTimes;
+    TArray<uint32> Serials;
+    TArray<FSimpleDelegate> Callbacks;
+    TBitArray<> ActiveTimers;
+    TArray<int32> FreeIndices;
+
+    // Wheel entries can outlive their timer; they are skipped when the serial no longer matches
+    TArray<FWheelEntry> NearSlots[NumNearSlots];
+    TArray<FWheelEntry> FarSlots[NumFarSlots];
+    TArray<FWheelEntry> Overflow;
+
+    // Scratch copy of the slot being fired, so callbacks may schedule new timers
+    TArray<FWheelEntry> FiringEntries;
+
+    // Last wheel slot that has been processed
+    int64 CurrentSlot = 0;
+
+    int32 NumActiveTimers = 0;
+    int32 FiredLastFrame = 0;
+    int32 SlotsVisitedLastFrame = 0;
+
+    double GetNow() const;
+    static int64 TimeToSlot(double Time);
+
+    bool IsCurrent(const FWheelEntry& Entry) const;
+    void Insert(const FWheelEntry& Entry);
+    void Release(int32 Index);
+    void ProcessSlot(int64 Slot, double Now);
+};
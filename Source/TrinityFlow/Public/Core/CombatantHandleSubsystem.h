@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "CombatantHandleSubsystem.generated.h"
+
+class UHealthComponent;
+class UTagComponent;
+class UStateComponent;
+class UShardComponent;
+class UStanceComponent;
+class UAnimationComponent;
+class UEnemyAnimationComponent;
+
+/**
+ * Combat components of one actor, resolved once instead of scanning the component array per hit
+ * Missing components stay null (e.g. enemies have no shard or stance component)
+ */
+struct FCombatantHandles
+{
+    TWeakObjectPtr<UHealthComponent> Health;
+    TWeakObjectPtr<UTagComponent> Tags;
+    TWeakObjectPtr<UStateComponent> State;
+    TWeakObjectPtr<UShardComponent> Shard;
+    TWeakObjectPtr<UStanceComponent> Stance;
+    TWeakObjectPtr<UAnimationComponent> Animation;
+    TWeakObjectPtr<UEnemyAnimationComponent> EnemyAnimation;
+
+    void Resolve(const AActor* Actor);
+};
+
+/**
+ * Per-world registry of FCombatantHandles keyed by actor
+ * Combatants register at BeginPlay and are removed automatically at EndPlay.
+ * Lookups for unregistered actors resolve and register on first use.
+ */
+UCLASS()
+class TRINITYFLOW_API UCombatantHandleSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    // Resolves the actor's components and stores them until the actor ends play
+    const FCombatantHandles& Register(AActor* Actor);
+
+    void Unregister(AActor* Actor);
+
+    // Handles for an actor; the reference is only valid until the next registration
+    const FCombatantHandles& Find(const AActor* Actor);
+
+    // Convenience lookup through the actor's world; returns empty handles for null actors
+    static const FCombatantHandles& Get(const AActor* Actor);
+
+private:
+    TMap<TObjectKey<AActor>, FCombatantHandles> Handles;
+
+    // Used for actors that are not playing (e.g. mid EndPlay) so they are not registered again
+    FCombatantHandles TransientHandles;
+
+    UFUNCTION()
+    void OnActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+};
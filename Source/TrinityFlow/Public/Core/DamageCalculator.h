@@ -3,11 +3,103 @@
 #include "CoreMinimal.h"
 #include "TrinityFlowTypes.h"
 
+struct FCompiledTagEffects;
+
+/**
+ * Structure-of-arrays input for batched damage calculation
+ * One entry per hit; all arrays always have the same length
+ */
+struct TRINITYFLOW_API FDamageBatch
+{
+    TArray<float> Amounts;
+    TArray<uint8> Types;        // EDamageType
+    TArray<float> Defences;
+    TArray<uint8> TagMasks;     // ECharacterTag
+    TArray<float> DirectionX;
+    TArray<float> DirectionY;
+    TArray<float> DirectionZ;
+    TArray<float> ForwardX;
+    TArray<float> ForwardY;
+    TArray<float> ForwardZ;
+
+    int32 Num() const { return Amounts.Num(); }
+
+    void Reset(int32 ExpectedNum = 0);
+
+    int32 Add(const FDamageInfo& DamageInfo, float TargetDefence, ECharacterTag TargetTags, const FVector& DamageDirection, const FVector& TargetForward);
+};
+
+/**
+ * Target-side response to one damage type, fully determined by the target's tag mask and defence
+ * FinalDamage = Amount * BaseMultiplier * TagMultiplier, unless immune or directionally blocked
+ */
+struct FDamageResponse
+{
+    float BaseMultiplier = 0.0f;    // Defence multiplier for physical, soul multiplier for soul
+    float TagMultiplier = 1.0f;
+    bool bImmune = false;
+    bool bBlocksFront = false;
+    bool bBlocksBack = false;
+};
+
+/**
+ * Memoizes FDamageResponse per (damage type, tag mask, defence) signature
+ * Enemies of one archetype share tags and defence, so most hits become a hash lookup plus a multiply.
+ * Defence is part of the key, so a changed defence simply maps to another entry; the whole cache is
+ * dropped when the active tag table changes. Opt-in through TrinityFlow.Damage.ResponseCache, since
+ * the per-lane lookup is only a win when tag effects are expensive to gather
+ * (measure with TrinityFlow.Damage.BenchmarkBatch).
+ */
+class TRINITYFLOW_API FDamageResponseCache
+{
+public:
+    FDamageResponse Find(EDamageType Type, ECharacterTag Tags, float Defence);
+
+    void Reset();
+
+    int32 Num() const { return Entries.Num(); }
+    uint64 GetHits() const { return Hits; }
+    uint64 GetMisses() const { return Misses; }
+    void ResetCounters() { Hits = 0; Misses = 0; }
+
+    // Signatures are few in practice; a run of unusual defence values just starts over
+    static constexpr int32 MaxEntries = 1024;
+
+private:
+    TMap<uint64, FDamageResponse> Entries;
+    uint32 TagTableVersion = 0;
+    uint64 Hits = 0;
+    uint64 Misses = 0;
+
+    static uint64 MakeKey(EDamageType Type, ECharacterTag Tags, float Defence);
+};
+
 class TRINITYFLOW_API FDamageCalculator
 {
 public:
     static float CalculateDamage(const FDamageInfo& DamageInfo, const FCharacterResources& TargetResources, ECharacterTag TargetTags, const FVector& DamageDirection, const FVector& TargetForward);
-    
+
+    // Vectorized equivalent of CalculateDamage for many hits at once; OutDamage must hold Batch.Num() entries
+    // With a response cache the per-hit defence and tag work is replaced by cached multipliers
+    static void CalculateDamageBatch(const FDamageBatch& Batch, TArrayView<float> OutDamage, FDamageResponseCache* ResponseCache = nullptr);
+
+    // Whether batch callers should pass their response cache (TrinityFlow.Damage.ResponseCache, off by default)
+    static bool IsResponseCacheEnabled();
+
+    // Uncached response for one signature (used to fill FDamageResponseCache)
+    static FDamageResponse BuildResponse(EDamageType Type, ECharacterTag TargetTags, float TargetDefence);
+
+#if !UE_BUILD_SHIPPING
+    // Compares the batch kernel against the scalar path on random inputs, returns the number of mismatches
+    static int32 VerifyBatchParity(int32 NumSamples, int32 Seed);
+#endif
+
 private:
-    static bool IsShieldBlocking(ECharacterTag Tags, const FVector& DamageDirection, const FVector& TargetForward);
-};
\ No newline at end of file
+    static bool IsShieldBlocking(const FCompiledTagEffects& TagEffects, EDamageType Type, const FVector& DamageDirection, const FVector& TargetForward);
+
+    static float CalculateDamageLane(const FDamageBatch& Batch, int32 Index);
+
+    static float ApplyResponse(const FDamageResponse& Response, float Amount, const FVector& DamageDirection, const FVector& TargetForward);
+
+    static void CalculateDamageBatchCached(const FDamageBatch& Batch, TArrayView<float> OutDamage, FDamageResponseCache& ResponseCache);
+};
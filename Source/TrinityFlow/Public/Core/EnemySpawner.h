@@ -33,9 +33,25 @@ public:
     UPROPERTY(EditAnywhere, Category = "Spawning")
     float SpawnDelay = 2.0f;
 
+    // Spawn HordeCount lightweight entities into UEnemyHordeSubsystem instead of one actor
+    UPROPERTY(EditAnywhere, Category = "Spawning|Horde")
+    bool bSpawnAsHorde = false;
+
+    UPROPERTY(EditAnywhere, Category = "Spawning|Horde", meta = (EditCondition = "bSpawnAsHorde", ClampMin = "1"))
+    int32 HordeCount = 100;
+
+    UPROPERTY(EditAnywhere, Category = "Spawning|Horde", meta = (EditCondition = "bSpawnAsHorde"))
+    float HordeSpawnRadius = 1500.0f;
+
+    // Drawn with instancing for entities that have not been promoted to actors
+    UPROPERTY(EditAnywhere, Category = "Spawning|Horde", meta = (EditCondition = "bSpawnAsHorde"))
+    class UStaticMesh* HordeMesh = nullptr;
+
     UFUNCTION()
     void SpawnEnemy();
 
+    static TSubclassOf<class AEnemyBase> GetEnemyClassForType(EEnemyType Type);
+
 protected:
-    TSubclassOf<class AEnemyBase> GetEnemyClassForType(EEnemyType Type);
+    void SpawnHorde(TSubclassOf<class AEnemyBase> EnemyClass);
 };
\ No newline at end of file
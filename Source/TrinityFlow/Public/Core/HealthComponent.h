@@ -8,6 +8,7 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHealthChanged, float, NewHealth);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDeath);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnDamageDealt, AActor*, DamagedActor, float, ActualDamage, AActor*, DamageInstigator, EDamageType, DamageType);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnResourcesChangedNative, const class UHealthComponent*);
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class TRINITYFLOW_API UHealthComponent : public UActorComponent
@@ -19,9 +20,22 @@ public:
 
     virtual void BeginPlay() override;
 
+    // Queues the hit with the combat resolution subsystem; health and events update at the end of the frame
     UFUNCTION()
     void TakeDamage(const FDamageInfo& DamageInfo, const FVector& DamageDirection);
 
+    // Resolution phase: applies a single hit to health without broadcasting, returns the health actually lost
+    float ApplyDamage(const FDamageInfo& DamageInfo, const FVector& DamageDirection);
+
+    // Resolution phase: subtracts already-calculated damage from health, returns the health actually lost
+    float ApplyFinalDamage(float FinalDamage);
+
+    // Tags used by the damage calculator for hits against this component
+    ECharacterTag GetDamageTags() const;
+
+    // Resolution phase: broadcasts the coalesced events for every hit applied to this component in one pass
+    void BroadcastResolvedDamage(const TArray<struct FResolvedDamageEvent>& Events);
+
     UFUNCTION()
     float GetHealth() const { return Resources.Health; }
 
@@ -46,6 +60,10 @@ public:
     UPROPERTY()
     FOnDeath OnDeath;
 
+    // Fires alongside OnHealthChanged (health, attack or defence changed) for native listeners such as HUD panels
+    FOnResourcesChangedNative OnResourcesChangedNative;
+
+    // Per-component event; native systems listen through the world's FCombatEventBus instead
     UPROPERTY()
     FOnDamageDealt OnDamageDealt;
 
@@ -15,8 +15,6 @@ class TRINITYFLOW_API UStateComponent : public UActorComponent
 public:
     UStateComponent();
 
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-
     UFUNCTION()
     void AddState(ECharacterState State);
 
@@ -36,7 +34,7 @@ public:
     bool IsMarked() const { return HasState(ECharacterState::Marked); }
 
     UFUNCTION()
-    float GetMarkedTimeRemaining() const { return MarkedTimer; }
+    float GetMarkedTimeRemaining() const;
 
     UPROPERTY()
     FOnStateChanged OnStateChanged;
@@ -45,11 +43,6 @@ protected:
     UPROPERTY()
     ECharacterState States = ECharacterState::NonCombat;
 
-    UPROPERTY()
-    float MarkedTimer = 0.0f;
-
-    UPROPERTY()
-    float VulnerableTimer = 0.0f;
 
 public:
     UFUNCTION()
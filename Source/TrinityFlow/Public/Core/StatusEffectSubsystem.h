@@ -0,0 +1,121 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Core/TrinityFlowTypes.h"
+#include "Core/CombatTimerSubsystem.h"
+#include "StatusEffectSubsystem.generated.h"
+
+/**
+ * Status effects tracked by UStatusEffectSubsystem
+ */
+enum class EStatusEffect : uint8
+{
+    Marked,         // Mirrors ECharacterState::Marked
+    Vulnerable,     // Mirrors ECharacterState::Vulnerable
+    DamageOverTime, // Magnitude is damage per second per stack
+    Slow,           // Magnitude is the walk speed reduction per stack (0-1)
+
+    Count
+};
+
+/** Stacking rules for one status effect */
+struct FStatusEffectDefinition
+{
+    uint8 MaxStacks = 1;
+
+    // Character state flag kept in sync on the owner's state component
+    ECharacterState StateFlag = ECharacterState::None;
+};
+
+/**
+ * Every active status effect in the world, stored as parallel arrays
+ * One row per (actor, effect) pair holds owner, effect id, stacks, expiry and magnitude. Expiries and
+ * damage-over-time ticks are scheduled on the UCombatTimerSubsystem wheel, so only rows with a due
+ * event are ever visited and nothing ticks per frame; per-actor queries go through a short index
+ * list per actor.
+ */
+UCLASS()
+class TRINITYFLOW_API UStatusEffectSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem implementation
+    virtual void Deinitialize() override;
+
+    // Convenience lookup through the object's world; null without a world
+    static UStatusEffectSubsystem* Get(const UObject* WorldContextObject);
+
+    static const FStatusEffectDefinition& GetDefinition(EStatusEffect Effect);
+
+    /**
+     * Applies or re-applies an effect. Re-applying adds a stack (up to the effect's limit), restarts the
+     * expiry at the new duration and takes the new magnitude. Instigator and damage type are used for
+     * damage-over-time ticks.
+     */
+    void ApplyEffect(AActor* Target, EStatusEffect Effect, float Duration, float Magnitude = 0.0f,
+        AActor* Instigator = nullptr, EDamageType DamageType = EDamageType::Physical);
+
+    void RemoveEffect(AActor* Target, EStatusEffect Effect);
+    void RemoveAllEffects(AActor* Target);
+
+    bool HasEffect(const AActor* Target, EStatusEffect Effect) const;
+    int32 GetStacks(const AActor* Target, EStatusEffect Effect) const;
+    float GetMagnitude(const AActor* Target, EStatusEffect Effect) const;
+    float GetTimeRemaining(const AActor* Target, EStatusEffect Effect) const;
+
+    // Profiling counters; expiries and damage ticks are totals since the world started
+    int32 GetNumEffects() const { return ExpiryTimes.Num(); }
+    int32 GetNumAffectedActors() const { return ActorEffects.Num(); }
+    uint64 GetTotalExpired() const { return TotalExpired; }
+    uint64 GetTotalDamageTicks() const { return TotalDamageTicks; }
+
+    // Seconds between damage-over-time applications
+    static constexpr float DamageTickInterval = 1.0f;
+
+    // Slow stacks never reduce walk speed below this fraction
+    static constexpr float MinSlowedSpeedScale = 0.1f;
+
+private:
+    // Effect rows
+    TArray<TObjectKey<AActor>> OwnerKeys;
+    TArray<TWeakObjectPtr<AActor>> Owners;
+    TArray<EStatusEffect> EffectIds;
+    TArray<uint8> Stacks;
+    TArray<double> ExpiryTimes;
+    TArray<float> Magnitudes;
+
+    // Timer wheel entries for the row's expiry and, for damage-over-time, its next damage tick
+    TArray<FCombatTimerHandle> ExpiryHandles;
+    TArray<FCombatTimerHandle> DamageHandles;
+
+    // Damage-over-time only; unused for other effects
+    TArray<TWeakObjectPtr<AActor>> Instigators;
+    TArray<EDamageType> DamageTypes;
+
+    // Row indices per actor
+    TMap<TObjectKey<AActor>, TArray<int32, TInlineAllocator<4>>> ActorEffects;
+
+    // Walk speed scale currently applied by Slow; divided back out so other speed writers are kept
+    TMap<TObjectKey<AActor>, float> AppliedSlowScales;
+
+    uint64 TotalExpired = 0;
+    uint64 TotalDamageTicks = 0;
+
+    int32 FindRow(const AActor* Target, EStatusEffect Effect) const;
+
+    // Swap-removes the row, keeping the per-actor index lists in sync and cancelling its timers
+    void RemoveRow(int32 Row);
+
+    // Timer callbacks; rows move on swap-removal, so they are looked up again by (actor, effect)
+    void OnEffectExpired(TWeakObjectPtr<AActor> Target, EStatusEffect Effect);
+    void OnDamageTick(TWeakObjectPtr<AActor> Target, EStatusEffect Effect);
+
+    void OnEffectRemoved(AActor* Target, EStatusEffect Effect);
+    void UpdateWalkSpeed(AActor* Target);
+
+    UFUNCTION()
+    void OnActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+};
@@ -26,7 +26,7 @@ public:
     ECharacterTag GetTags() const { return Tags; }
 
     UFUNCTION()
-    void SetTags(ECharacterTag NewTags) { Tags = NewTags; }
+    void SetTags(ECharacterTag NewTags);
 
 protected:
     UPROPERTY()
@@ -27,6 +27,10 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Stats Configuration")
     class UDataTable* WeaponStatsTable;
 
+    // FCharacterTagData rows; compiled into the runtime tag effect table
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Stats Configuration")
+    class UDataTable* TagDataTable;
+
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Stats Configuration")
     class UTrinityFlowCharacterStats* DefaultPlayerStats;
 
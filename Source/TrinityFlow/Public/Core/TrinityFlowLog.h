@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/LogMacros.h"
+
+/**
+ * Gameplay log categories
+ * Per-hit, per-path and per-frame diagnostics log at Verbose/VeryVerbose. Shipping and Test (profiling)
+ * builds compile everything below Warning out of these categories, so those call sites cost nothing there;
+ * define TRINITYFLOW_STRIP_VERBOSE_LOGS=1 to get the same in a Development build.
+ */
+#ifndef TRINITYFLOW_STRIP_VERBOSE_LOGS
+#define TRINITYFLOW_STRIP_VERBOSE_LOGS (UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#endif
+
+#if TRINITYFLOW_STRIP_VERBOSE_LOGS
+#define TRINITYFLOW_LOG_COMPILE_VERBOSITY Warning
+#else
+#define TRINITYFLOW_LOG_COMPILE_VERBOSITY All
+#endif
+
+DECLARE_LOG_CATEGORY_EXTERN(LogTrinityFlowCombat, Log, TRINITYFLOW_LOG_COMPILE_VERBOSITY);
+DECLARE_LOG_CATEGORY_EXTERN(LogTrinityFlowAI, Log, TRINITYFLOW_LOG_COMPILE_VERBOSITY);
+DECLARE_LOG_CATEGORY_EXTERN(LogTrinityFlowUI, Log, TRINITYFLOW_LOG_COMPILE_VERBOSITY);
+DECLARE_LOG_CATEGORY_EXTERN(LogTrinityFlowData, Log, TRINITYFLOW_LOG_COMPILE_VERBOSITY);
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+/**
+ * Profiling hooks for gameplay systems
+ * `stat TrinityFlow` shows the cycle stats and per-frame counters below (plus the tick time of every
+ * TrinityFlow world subsystem), `csvprofile start` records the TrinityFlow CSV category, and the
+ * TrinityFlow trace channel (`-trace=cpu,trinityflow`) tags the same scopes in Unreal Insights.
+ */
+DECLARE_STATS_GROUP(TEXT("TrinityFlow"), STATGROUP_TrinityFlow, STATCAT_Advanced);
+
+// Combat
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Damage Resolution"), STAT_TrinityFlow_DamageResolution, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Damage Requests"), STAT_TrinityFlow_DamageRequests, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+
+// AI
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI Idle State"), STAT_TrinityFlow_AIIdle, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI Chase State"), STAT_TrinityFlow_AIChase, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI Attack State"), STAT_TrinityFlow_AIAttack, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI Decisions"), STAT_TrinityFlow_AIDecisions, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Perception Dispatch"), STAT_TrinityFlow_PerceptionDispatch, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Perception Traces"), STAT_TrinityFlow_PerceptionTraces, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Path Dispatch"), STAT_TrinityFlow_PathDispatch, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Path Apply"), STAT_TrinityFlow_PathApply, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Path Requests"), STAT_TrinityFlow_PathRequests, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+
+// UI
+DECLARE_CYCLE_STAT_EXTERN(TEXT("HUD Tick"), STAT_TrinityFlow_HUDTick, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("HUD Projection"), STAT_TrinityFlow_HUDProjection, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("HUD Anchors Projected"), STAT_TrinityFlow_HUDAnchorsProjected, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy Info Panels"), STAT_TrinityFlow_EnemyInfoPanels, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Damage Number Paint"), STAT_TrinityFlow_DamageNumberPaint, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Damage Numbers Painted"), STAT_TrinityFlow_DamageNumbersPainted, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("HUD Widgets"), STAT_TrinityFlow_HUDWidgets, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("HUD Widget Invalidations"), STAT_TrinityFlow_HUDWidgetInvalidations, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+
+// Data
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Stats Loading"), STAT_TrinityFlow_StatsLoading, STATGROUP_TrinityFlow, TRINITYFLOW_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(TRINITYFLOW_API, TrinityFlow);
+
+UE_TRACE_CHANNEL_EXTERN(TrinityFlowChannel, TRINITYFLOW_API);
+
+// Times a scope in the STAT_TrinityFlow_<Name> cycle stat, the TrinityFlow CSV category and the TrinityFlow trace channel
+#define TRINITYFLOW_SCOPE_CYCLE_COUNTER(Name) \
+    SCOPE_CYCLE_COUNTER(STAT_TrinityFlow_##Name); \
+    CSV_SCOPED_TIMING_STAT(TrinityFlow, Name); \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(TrinityFlow_##Name, TrinityFlowChannel)
+
+// Adds to a STAT_TrinityFlow_<Name> counter and the matching per-frame CSV stat
+#define TRINITYFLOW_INC_COUNTER(Name, Amount) \
+    INC_DWORD_STAT_BY(STAT_TrinityFlow_##Name, Amount); \
+    CSV_CUSTOM_STAT(TrinityFlow, Name, Amount, ECsvCustomStatOp::Accumulate)
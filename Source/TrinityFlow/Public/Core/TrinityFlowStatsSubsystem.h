@@ -81,6 +81,9 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category = "Configuration")
     TSoftObjectPtr<UDataTable> WeaponStatsTable;
 
+    UPROPERTY(EditDefaultsOnly, Category = "Configuration")
+    TSoftObjectPtr<UDataTable> TagDataTable;
+
     // Default assets for quick access
     UPROPERTY(EditDefaultsOnly, Category = "Configuration")
     TSoftObjectPtr<UTrinityFlowCharacterStats> DefaultPlayerStats;
@@ -101,5 +104,6 @@ private:
 
     void LoadCharacterStats();
     void LoadWeaponStats();
+    void LoadTagTable();
     void ClearCache();
 };
\ No newline at end of file
@@ -60,7 +60,6 @@ public:
     // Helper function to get tags as enum
     ECharacterTag GetCharacterTags() const 
     { 
-        UE_LOG(LogTemp, Warning, TEXT("CharacterStats %s - Raw tag int value: %d"), *CharacterName, CharacterTags);
         return static_cast<ECharacterTag>(CharacterTags); 
     }
 
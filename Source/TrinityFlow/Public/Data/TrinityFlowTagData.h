@@ -88,6 +88,101 @@ struct FCharacterTagData : public FTableRowBase
     }
 };
 
+/**
+ * Combined gameplay effect of every tag in one ECharacterTag mask
+ * Baked once by FCompiledTagTable so the damage path is a single indexed load
+ */
+struct FCompiledTagEffects
+{
+    /** Damage types (bit per EDamageType) the mask is immune to */
+    uint8 ImmunityMask = 0;
+
+    /** Damage types blocked when the hit comes from the front / from behind */
+    uint8 FrontBlockMask = 0;
+    uint8 BackBlockMask = 0;
+
+    /** Final multiplier per EDamageType (reductions and modifiers folded together) */
+    float DamageMultipliers[2] = { 1.0f, 1.0f };
+
+    /** Union of the conflicting / required tags of every tag in the mask */
+    uint8 ConflictMask = 0;
+    uint8 RequirementMask = 0;
+
+    bool IsImmune(EDamageType Type) const { return (ImmunityMask & (1 << static_cast<uint8>(Type))) != 0; }
+    float GetMultiplier(EDamageType Type) const { return DamageMultipliers[static_cast<uint8>(Type)]; }
+};
+
+/**
+ * Runtime form of the tag DataTable
+ * Holds per-bit effect data for ECharacterTag plus a baked entry for each of the 256 tag masks.
+ * Built once from the FCharacterTagData rows; tags without a row, or whose row has EffectType None, keep
+ * the built-in effects (Ghost: physical immunity, Mechanical: soul immunity, Shielded: frontal physical block).
+ * Compiled tables are cached per DataTable and recompiled when the DataTable reports a change (editor
+ * edits, reimports); if the active table came from that DataTable it is replaced as well.
+ */
+class TRINITYFLOW_API FCompiledTagTable
+{
+public:
+    static constexpr int32 NumTagBits = 8;
+    static constexpr int32 NumTagMasks = 1 << NumTagBits;
+    static constexpr int32 NumDamageTypes = 2;
+
+    /** Builds the default table */
+    FCompiledTagTable();
+
+    /** Builds a table from the rows of a tag DataTable (null = defaults only) and caches it for the DataTable */
+    static TSharedRef<FCompiledTagTable> Compile(const UDataTable* TagDataTable);
+
+    /** Returns the compiled table for a DataTable, compiling it on first use */
+    static TSharedRef<FCompiledTagTable> FindOrCompile(const UDataTable* TagDataTable);
+
+    /** Table used by gameplay (damage calculation). Game thread only. */
+    static const FCompiledTagTable& Get();
+    static void SetActive(TSharedPtr<FCompiledTagTable> NewTable);
+
+    /** Incremented whenever the active table changes, so caches built from it can be dropped */
+    static uint32 GetActiveVersion();
+
+    const FCompiledTagEffects& GetEffects(ECharacterTag Tags) const { return MaskEffects[static_cast<uint8>(Tags)]; }
+
+    /** Conflict and requirement check for a full tag mask */
+    bool IsValidCombination(ECharacterTag Tags) const
+    {
+        const FCompiledTagEffects& Effects = GetEffects(Tags);
+        const uint8 Mask = static_cast<uint8>(Tags);
+        return (Effects.ConflictMask & Mask) == 0 && (Effects.RequirementMask & ~Mask) == 0;
+    }
+
+    /** Comma separated display names, cached per mask */
+    const FString& GetDisplayString(ECharacterTag Tags) const { return DisplayStrings[static_cast<uint8>(Tags)]; }
+
+    /** Converts tag names to a mask; returns false if any name is not an ECharacterTag */
+    bool MakeTagMask(const TArray<FName>& TagNames, ECharacterTag& OutTags) const;
+
+    /** Bit index of a tag name, INDEX_NONE if unknown */
+    int32 FindTagBit(FName TagName) const;
+
+private:
+    struct FTagBitData
+    {
+        FName TagName;
+        FString DisplayName;
+        ETagEffectType EffectType = ETagEffectType::None;
+        uint8 ImmunityMask = 0;
+        float ReductionPercent = 0.0f;
+        float DamageMultiplier = 1.0f;
+        bool bBlockFromFront = true;
+        uint8 ConflictMask = 0;
+        uint8 RequirementMask = 0;
+    };
+
+    FTagBitData Bits[NumTagBits];
+    FCompiledTagEffects MaskEffects[NumTagMasks];
+    FString DisplayStrings[NumTagMasks];
+
+    void BakeMasks();
+};
+
 /**
  * Manager class for tag data access
  * This could be integrated into the stats subsystem
@@ -109,4 +204,8 @@ public:
 
     UFUNCTION(BlueprintCallable, Category = "Tags")
     static FString GetTagDisplayString(UDataTable* TagDataTable, const TArray<FName>& Tags);
+
+    /** Mask based variants backed by the active compiled table */
+    static bool ValidateTagMask(ECharacterTag Tags);
+    static const FString& GetTagMaskDisplayString(ECharacterTag Tags);
 };
\ No newline at end of file
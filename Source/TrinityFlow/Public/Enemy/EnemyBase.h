@@ -56,11 +56,6 @@ protected:
     UPROPERTY()
     class APawn* PlayerTarget;
 
-    // Visibility trace caching for performance
-    float LastVisibilityCheck = -1.0f;
-    bool bCachedCanSeePlayer = false;
-    static constexpr float VisibilityCacheTime = 0.2f; // Cache for 0.2 seconds
-
 public:
     UPROPERTY()
     bool bHasSeenPlayer = false;
@@ -106,6 +101,10 @@ public:
     UFUNCTION(BlueprintPure, Category = "AI")
     UAIStateMachine* GetAIStateMachine() const { return AIStateMachine; }
 
+    // Stats source used by SetupEnemy (also read from class defaults by the horde subsystem)
+    FName GetEnemyStatsID() const { return EnemyStatsID; }
+    UTrinityFlowCharacterStats* GetOverrideStats() const { return OverrideStats; }
+
     UPROPERTY(EditDefaultsOnly, Category = "AI")
     TSubclassOf<class UAIState> InitialStateClass;
 
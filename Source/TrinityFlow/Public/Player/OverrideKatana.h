@@ -50,6 +50,8 @@ protected:
     UPROPERTY()
     AActor* DodgeAttacker = nullptr;
 
+    // Code Break against the nearest horde entity in front of the owner's aim
+    void CodeBreakHorde(float CodeBreakRange);
 
 public:
     virtual void Tick(float DeltaTime) override;
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+#include "UObject/ObjectKey.h"
+#include "Core/TrinityFlowTypes.h"
+
+class FTrinityFlowHUDProjection;
+enum class EHUDProjectionFlags : uint8;
+
+/**
+ * Floating damage numbers for TrinityFlow, drawn by one leaf widget
+ * Entries live in a fixed-capacity ring (the oldest is overwritten when full) and are projected in a
+ * single batch against the view the HUD projection service captured this frame. Fonts are built once per size
+ * step, and all shadows and all numbers share one layer each so Slate batches them together.
+ * Hits on the same target within MergeWindow add to the existing number instead of stacking a new one,
+ * until that number has been up for MaxMergedLifeTime.
+ */
+class TRINITYFLOW_API STrinityFlowDamageNumberLayer : public SLeafWidget
+{
+public:
+    SLATE_BEGIN_ARGS(STrinityFlowDamageNumberLayer) {}
+        SLATE_ARGUMENT(TSharedPtr<FTrinityFlowHUDProjection>, Projection)
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments& InArgs);
+
+    // HorizontalOffset is drawn by the caller so replays reproduce it
+    void AddDamageNumber(const FVector& WorldLocation, float Damage, bool bIsEcho, EDamageType DamageType,
+        const AActor* Target, float HorizontalOffset);
+
+    int32 GetNumLive() const;
+
+    virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+        FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+    virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override { return FVector2D::ZeroVector; }
+
+private:
+    struct FDamageNumberEntry
+    {
+        FVector WorldLocation = FVector::ZeroVector;
+        FObjectKey Target;
+        FString Text;
+        FLinearColor Color = FLinearColor::White;
+        float Damage = 0.0f;
+        float HorizontalOffset = 0.0f;
+        int32 FontIndex = 0;
+        double StartTime = 0.0;
+        double LastHitTime = 0.0;
+        double ExpireTime = 0.0;
+        EDamageType DamageType = EDamageType::Physical;
+        bool bIsEcho = false;
+    };
+
+    static constexpr int32 Capacity = 256;
+    static constexpr int32 NumFontSteps = 11;
+    static constexpr double LifeTime = 2.0;
+    static constexpr double FadeTime = 0.5;
+    static constexpr double MergeWindow = 0.2;
+
+    // Merging extends an entry's life but not its rise; past this age later hits start a new number
+    static constexpr double MaxMergedLifeTime = 4.0;
+
+    // Merging only looks at the most recent entries; a burst on one target lands among them
+    static constexpr int32 MergeSearchDepth = 16;
+
+    void RefreshEntry(FDamageNumberEntry& Entry) const;
+
+    TArray<FDamageNumberEntry> Entries;
+    int32 Head = 0;
+
+    // Paint returns straight away once every entry has expired
+    double LatestExpireTime = 0.0;
+
+    TArray<FSlateFontInfo> Fonts;
+
+    TSharedPtr<FTrinityFlowHUDProjection> Projection;
+
+    // Paint scratch, kept to avoid reallocating every frame
+    mutable TArray<int32> PaintEntries;
+    mutable TArray<FVector> PaintWorldPoints;
+    mutable TArray<FVector2f> PaintPositions;
+    mutable TArray<EHUDProjectionFlags> PaintFlags;
+};
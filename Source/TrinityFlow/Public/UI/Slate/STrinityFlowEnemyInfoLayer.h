@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "UObject/ObjectKey.h"
+
+class AEnemyBase;
+class UHealthComponent;
+class STrinityFlowEnemyInfoPanel;
+class FTrinityFlowHUDProjection;
+
+/**
+ * Enemy info panels for the HUD, driven by registration and health events
+ * Enemies are added and removed as they register with the UI manager. A small pool of panels is
+ * handed to the most relevant enemies (defending against them, chasing the player, recently hit, on
+ * screen, close), re-ranked a few times per second. Panel text only changes when the enemy's health
+ * component reports a change. Positions come from the HUD projection service; a panel's transform is
+ * only touched when it moves by a whole pixel, and distant panels move every few frames.
+ */
+class TRINITYFLOW_API STrinityFlowEnemyInfoLayer : public SCompoundWidget
+{
+public:
+    SLATE_BEGIN_ARGS(STrinityFlowEnemyInfoLayer) {}
+        SLATE_ARGUMENT(TSharedPtr<FTrinityFlowHUDProjection>, Projection)
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments& InArgs);
+    virtual ~STrinityFlowEnemyInfoLayer();
+
+    void AddEnemy(AEnemyBase* Enemy);
+    void RemoveEnemy(AEnemyBase* Enemy);
+
+    // Defending enemies always get a panel so the timing bar is visible
+    void ShowTimingBar(AEnemyBase* Enemy, float Duration, float PerfectStart, float PerfectEnd);
+    void HideTimingBar(AEnemyBase* Enemy);
+
+    // Called from the HUD tick, after the projection service has updated
+    void Update(UWorld* World, float DeltaTime);
+
+    int32 GetNumTracked() const { return TrackedEnemies.Num(); }
+    int32 GetNumShown() const;
+
+private:
+    struct FTrackedEnemy
+    {
+        TObjectKey<AEnemyBase> Key;
+        TWeakObjectPtr<AEnemyBase> Enemy;
+        TWeakObjectPtr<UHealthComponent> Health;
+        FDelegateHandle ResourcesChangedHandle;
+        double LastChangeTime = -1000.0;
+        float Relevance = 0.0f;
+        float Distance = 0.0f;
+        int32 PanelIndex = INDEX_NONE;
+        bool bTimingActive = false;
+    };
+
+    struct FPanelSlot
+    {
+        TSharedPtr<STrinityFlowEnemyInfoPanel> Panel;
+        TWeakObjectPtr<AEnemyBase> Enemy;
+        int32 AnchorHandle = INDEX_NONE;
+        FVector2f ShownPosition = FVector2f(-1.0f, -1.0f);
+        bool bInUse = false;
+        bool bStatsDirty = false;
+        bool bNeedsPosition = false;
+        bool bDistant = false;
+    };
+
+    void OnResourcesChanged(const UHealthComponent* Health, TObjectKey<AEnemyBase> EnemyKey);
+
+    void ScoreRelevance(UWorld* World);
+    void SelectPanels(UWorld* World);
+    void ReleasePanel(FTrackedEnemy& Tracked);
+    int32 AcquirePanel(FTrackedEnemy& Tracked);
+    void RemoveTrackedAt(int32 Index);
+
+    TArray<FTrackedEnemy> TrackedEnemies;
+    TMap<TObjectKey<AEnemyBase>, int32> TrackedIndices;
+
+    TArray<FPanelSlot> PanelSlots;
+    TSharedPtr<class SOverlay> PanelOverlay;
+    TSharedPtr<FTrinityFlowHUDProjection> Projection;
+
+    // Scratch for ranking
+    TArray<int32> RankedIndices;
+
+    float TimeSinceSelection = 0.0f;
+    bool bSelectionDirty = true;
+    uint32 FrameCounter = 0;
+};
@@ -13,14 +13,24 @@ public:
     SLATE_END_ARGS()
 
     void Construct(const FArguments& InArgs);
-    void Update();
+
+    // Pooled panels are rebound as enemies become relevant; the name is only built here
+    void SetEnemy(AEnemyBase* Enemy);
+    AEnemyBase* GetEnemy() const { return TargetEnemy.Get(); }
+
+    // Called when the enemy's health or resources changed
+    void RefreshStats();
     
     // Timing bar control
     void ShowTimingBar(float Duration, float PerfectStart, float PerfectEnd);
     void HideTimingBar();
 
 private:
-    AEnemyBase* TargetEnemy = nullptr;
+    TWeakObjectPtr<AEnemyBase> TargetEnemy;
+
+    // Last values written to the stats text, so unchanged resources skip the format
+    float ShownAttack = -1.0f;
+    float ShownDefence = -1.0f;
 
     TSharedPtr<class STextBlock> NameText;
     TSharedPtr<class SProgressBar> HealthBar;
@@ -7,12 +7,19 @@
 class UTrinityFlowUIManager;
 class STrinityFlowHealthBar;
 class STrinityFlowWeaponPanel;
-class STrinityFlowDamageNumber;
-class STrinityFlowEnemyInfoPanel;
+class STrinityFlowDamageNumberLayer;
+class STrinityFlowEnemyInfoLayer;
+class FTrinityFlowHUDProjection;
+class FTrinityFlowHUDViewModel;
 class AEnemyBase;
+class AActor;
 
 /**
  * Main HUD Widget for TrinityFlow
+ * Player state comes from the UI manager's HUD view-model; each tick the HUD compares versions and
+ * only re-formats the fields that changed. The static parts sit in invalidation panels so Slate reuses
+ * their cached layout and draw elements until one of their widgets changes, while the enemy panels,
+ * damage numbers and animated bars stay outside.
  */
 class TRINITYFLOW_API STrinityFlowHUD : public SCompoundWidget
 {
@@ -22,30 +29,37 @@ public:
     SLATE_END_ARGS()
 
     void Construct(const FArguments& InArgs);
+    virtual ~STrinityFlowHUD();
     virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
 
-    // HUD Updates
-    void UpdatePlayerHealth(float HealthPercentage);
-    void UpdateWeaponCooldowns(float QCooldown, float TabCooldown, float ECooldown, float RCooldown);
-    void UpdatePlayerStats(int32 SoulActive, int32 PowerActive, int32 SoulInactive, int32 PowerInactive, float SoulBonus, float PhysicalBonus);
-    void UpdateCombatState(bool bInCombat);
-    
     // Damage Numbers
-    void AddDamageNumber(const FVector& WorldLocation, float Damage, bool bIsEcho, EDamageType DamageType);
+    void AddDamageNumber(const FVector& WorldLocation, float Damage, bool bIsEcho, EDamageType DamageType, const AActor* Target = nullptr);
     
+    // Enemy info panels, fed by the UI manager's enemy registration
+    void AddEnemy(AEnemyBase* Enemy);
+    void RemoveEnemy(AEnemyBase* Enemy);
+
     // Defense timing bar
     void ShowDefenseTiming(float Duration, float PerfectStart, float PerfectEnd);
     void HideDefenseTiming();
     void ShowEnemyDefenseTiming(AEnemyBase* Enemy, float Duration, float PerfectStart, float PerfectEnd);
     void HideEnemyDefenseTiming(AEnemyBase* Enemy);
-    
-    // Stance flow bar
-    void ShowStanceBar();
-    void HideStanceBar();
-    void UpdateStanceBar(float FlowPosition);
 
 private:
-    void UpdateEnemyInfoPanels(const FGeometry& AllottedGeometry);
+    // Applies view-model fields whose version moved since the last sync
+    void SyncViewModel(const FTrinityFlowHUDViewModel& ViewModel);
+
+#if !UE_BUILD_SHIPPING
+    // TrinityFlow.UI.WidgetStats: widget count and per-frame invalidations of the HUD tree
+    void UpdateWidgetStats();
+#if WITH_SLATE_DEBUGGING
+    void OnWidgetInvalidated(const struct FSlateDebuggingInvalidateArgs& Args);
+#endif
+
+    TSet<const SWidget*> StatsWidgets;
+    FDelegateHandle WidgetInvalidatedHandle;
+    int32 InvalidationsSinceLastTick = 0;
+#endif
 
     // Widget References
     TSharedPtr<STrinityFlowHealthBar> HealthBar;
@@ -53,10 +67,13 @@ private:
     TSharedPtr<STrinityFlowWeaponPanel> RightWeaponPanel;
     TSharedPtr<class STextBlock> CombatStateText;
     TSharedPtr<class SVerticalBox> PlayerStatsBox;
-    TSharedPtr<class SOverlay> DamageNumberOverlay;
-    TSharedPtr<class SOverlay> EnemyInfoOverlay;
     TSharedPtr<class STrinityFlowDefenseTimingBar> DefenseTimingBar;
     TSharedPtr<class STrinityFlowStanceBar> StanceBar;
+
+    // Cached sections
+    TSharedPtr<class SInvalidationPanel> StaticPanel;
+    TSharedPtr<class SInvalidationPanel> CrosshairPanel;
+    bool bCachingStaticPanels = true;
     
     // Player stats text blocks
     TSharedPtr<class STextBlock> StanceText;
@@ -65,11 +82,25 @@ private:
     TSharedPtr<class STextBlock> DamageBonusText;
     
     // Damage Numbers
-    TArray<TSharedPtr<STrinityFlowDamageNumber>> DamageNumbers;
+    TSharedPtr<STrinityFlowDamageNumberLayer> DamageNumberLayer;
 
     // Enemy Info Panels
-    TMap<AEnemyBase*, TSharedPtr<STrinityFlowEnemyInfoPanel>> EnemyInfoPanels;
+    TSharedPtr<STrinityFlowEnemyInfoLayer> EnemyInfoLayer;
+
+    // World-to-screen positions for everything above, captured once per tick
+    TSharedPtr<FTrinityFlowHUDProjection> Projection;
     
+    // View-model versions already shown
+    uint32 SeenViewModelVersion = 0;
+    uint32 SeenHealthVersion = 0;
+    uint32 SeenStanceVersion = 0;
+    uint32 SeenShardsVersion = 0;
+    uint32 SeenDamageBonusVersion = 0;
+    uint32 SeenCooldownsVersion = 0;
+    uint32 SeenCombatVersion = 0;
+    uint32 SeenStanceBarVersion = 0;
+    uint32 SeenStanceFlowVersion = 0;
+
     // UI Manager reference
     UTrinityFlowUIManager* UIManager = nullptr;
 };
\ No newline at end of file
@@ -66,6 +66,7 @@ private:
     // Activation Progress
     bool bIsActivating = false;
     float ActivationProgress = 0.0f;
+    FDelegateHandle ActivationEndedHandle;
     
     // Input Handling
     void HandleInput(const FKey& Key);
@@ -77,6 +78,8 @@ private:
     void UpdateActivationDisplay();
     void StartActivation();
     void UpdateActivationProgress(float Progress);
+    void OnActivationEnded(bool bCompleted);
+    void UpdateTickState();
     
     EStanceType CalculateResultingStance() const;
     FLinearColor GetStanceColor(EStanceType Stance) const;
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UWorld;
+
+// Result flags of a projected point
+enum class EHUDProjectionFlags : uint8
+{
+    None = 0,
+    // In front of the camera; the screen position is valid
+    InFront = 1 << 0,
+    // In front of the camera and inside the player's view rect
+    OnScreen = 1 << 1
+};
+ENUM_CLASS_FLAGS(EHUDProjectionFlags);
+
+/**
+ * World-to-screen projection shared by every HUD element
+ * Update captures the local player's view-projection matrix once per frame and projects all
+ * registered anchors in one pass; widgets then read the cached screen positions instead of going
+ * through APlayerController::ProjectWorldLocationToScreen per element. Points that are not tied to an
+ * actor (such as floating damage numbers) can be projected in batches against the same captured view.
+ * Screen positions are in viewport pixels, as with ProjectWorldLocationToScreen.
+ */
+class TRINITYFLOW_API FTrinityFlowHUDProjection
+{
+public:
+    // Captures the view and projects every anchor; called once per frame from the HUD tick
+    void Update(UWorld* World);
+
+    bool HasView() const { return bHasView; }
+
+    // Anchors follow an actor's location plus an offset; new anchors are projected straight away
+    int32 AddAnchor(const AActor* Actor, const FVector& Offset);
+    void RemoveAnchor(int32 Handle);
+
+    FVector2f GetAnchorPosition(int32 Handle) const { return ScreenPositions[Handle]; }
+    EHUDProjectionFlags GetAnchorFlags(int32 Handle) const { return Flags[Handle]; }
+
+    int32 GetNumAnchors() const { return AnchorActors.Num() - FreeAnchors.Num(); }
+
+    // Projects points against this frame's view; OutPositions and OutFlags are resized to match
+    void ProjectPoints(TConstArrayView<FVector> WorldPoints, TArray<FVector2f>& OutPositions, TArray<EHUDProjectionFlags>& OutFlags) const;
+
+private:
+    bool CaptureView(UWorld* World);
+    void ProjectRange(const FVector* WorldPoints, FVector2f* OutPositions, EHUDProjectionFlags* OutFlags, int32 Num) const;
+
+    // Anchors are stored as parallel arrays so the projection loop walks contiguous memory
+    TArray<TWeakObjectPtr<const AActor>> AnchorActors;
+    TArray<FVector> AnchorOffsets;
+    TArray<FVector> AnchorWorldPoints;
+    TArray<FVector2f> ScreenPositions;
+    TArray<EHUDProjectionFlags> Flags;
+    TArray<int32> FreeAnchors;
+
+    FMatrix ViewProjection = FMatrix::Identity;
+    FIntRect ViewRect;
+    bool bHasView = false;
+};
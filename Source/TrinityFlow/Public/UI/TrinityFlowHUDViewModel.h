@@ -0,0 +1,113 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/TrinityFlowTypes.h"
+
+/**
+ * A value with a change version
+ * Set only bumps the version when the value actually differs, so readers compare versions instead of
+ * values and redo their formatting only after a real change.
+ */
+template<typename T>
+class TTrinityFlowObservable
+{
+public:
+    TTrinityFlowObservable() = default;
+    explicit TTrinityFlowObservable(const T& InValue) : Value(InValue) {}
+
+    // Returns true when the value changed
+    bool Set(const T& NewValue)
+    {
+        if (Value == NewValue)
+        {
+            return false;
+        }
+        Value = NewValue;
+        Version++;
+        return true;
+    }
+
+    const T& Get() const { return Value; }
+    uint32 GetVersion() const { return Version; }
+
+    // Updates SeenVersion and returns true if the value changed since the caller last looked
+    bool Consume(uint32& SeenVersion) const
+    {
+        if (SeenVersion == Version)
+        {
+            return false;
+        }
+        SeenVersion = Version;
+        return true;
+    }
+
+private:
+    T Value = T();
+    uint32 Version = 1;
+};
+
+struct FHUDShardCounts
+{
+    int32 SoulActive = 0;
+    int32 PowerActive = 0;
+    int32 SoulInactive = 0;
+    int32 PowerInactive = 0;
+
+    bool operator==(const FHUDShardCounts& Other) const
+    {
+        return SoulActive == Other.SoulActive && PowerActive == Other.PowerActive
+            && SoulInactive == Other.SoulInactive && PowerInactive == Other.PowerInactive;
+    }
+};
+
+/**
+ * Player-facing HUD state, written by gameplay through the UI manager and read by the HUD
+ * Values are stored at display precision (whole percents, whole cooldown seconds) so changes that
+ * would not alter what is on screen do not count as changes. Any write bumps the model version, which
+ * lets the HUD skip the whole model with a single compare on frames where nothing happened.
+ */
+class TRINITYFLOW_API FTrinityFlowHUDViewModel
+{
+public:
+    uint32 GetVersion() const { return Version; }
+
+    void SetPlayerHealth(float HealthPercentage) { Touch(PlayerHealth.Set(HealthPercentage)); }
+    void SetStance(EStanceType NewStance) { Touch(Stance.Set(NewStance)); }
+    void SetShardCounts(const FHUDShardCounts& Counts) { Touch(ShardCounts.Set(Counts)); }
+    void SetDamageBonus(float SoulBonus, float PhysicalBonus)
+    {
+        Touch(DamageBonusPercent.Set(FIntPoint(FMath::RoundToInt(SoulBonus * 100), FMath::RoundToInt(PhysicalBonus * 100))));
+    }
+    // Q, Tab, E, R in seconds; shown rounded up to whole seconds
+    void SetCooldowns(float QCooldown, float TabCooldown, float ECooldown, float RCooldown)
+    {
+        Touch(CooldownSeconds.Set(FIntVector4(FMath::CeilToInt(QCooldown), FMath::CeilToInt(TabCooldown),
+            FMath::CeilToInt(ECooldown), FMath::CeilToInt(RCooldown))));
+    }
+    void SetInCombat(bool bInCombat) { Touch(InCombat.Set(bInCombat)); }
+    void SetStanceBarVisible(bool bVisible) { Touch(StanceBarVisible.Set(bVisible)); }
+    void SetStanceFlow(float FlowPosition) { Touch(StanceFlow.Set(FlowPosition)); }
+
+    const TTrinityFlowObservable<float>& GetPlayerHealth() const { return PlayerHealth; }
+    const TTrinityFlowObservable<EStanceType>& GetStance() const { return Stance; }
+    const TTrinityFlowObservable<FHUDShardCounts>& GetShardCounts() const { return ShardCounts; }
+    const TTrinityFlowObservable<FIntPoint>& GetDamageBonusPercent() const { return DamageBonusPercent; }
+    const TTrinityFlowObservable<FIntVector4>& GetCooldownSeconds() const { return CooldownSeconds; }
+    const TTrinityFlowObservable<bool>& GetInCombat() const { return InCombat; }
+    const TTrinityFlowObservable<bool>& GetStanceBarVisible() const { return StanceBarVisible; }
+    const TTrinityFlowObservable<float>& GetStanceFlow() const { return StanceFlow; }
+
+private:
+    void Touch(bool bChanged) { Version += bChanged ? 1 : 0; }
+
+    TTrinityFlowObservable<float> PlayerHealth{1.0f};
+    TTrinityFlowObservable<EStanceType> Stance{EStanceType::Balanced};
+    TTrinityFlowObservable<FHUDShardCounts> ShardCounts;
+    TTrinityFlowObservable<FIntPoint> DamageBonusPercent{FIntPoint::ZeroValue};
+    TTrinityFlowObservable<FIntVector4> CooldownSeconds{FIntVector4(0, 0, 0, 0)};
+    TTrinityFlowObservable<bool> InCombat{false};
+    TTrinityFlowObservable<bool> StanceBarVisible{false};
+    TTrinityFlowObservable<float> StanceFlow{0.5f};
+
+    uint32 Version = 1;
+};
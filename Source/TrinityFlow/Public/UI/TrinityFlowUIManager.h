@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Core/TrinityFlowTypes.h"
+#include "Core/CombatEventBus.h"
+#include "UI/TrinityFlowHUDViewModel.h"
 #include "TrinityFlowUIManager.generated.h"
 
 UENUM(BlueprintType)
@@ -62,7 +64,7 @@ public:
 
     // HUD Functions
     UFUNCTION(BlueprintCallable, Category = "UI")
-    void AddDamageNumber(const FVector& WorldLocation, float Damage, bool bIsEcho = false, EDamageType DamageType = EDamageType::Physical);
+    void AddDamageNumber(const FVector& WorldLocation, float Damage, bool bIsEcho = false, EDamageType DamageType = EDamageType::Physical, AActor* Target = nullptr);
 
     UFUNCTION(BlueprintCallable, Category = "UI")
     void UpdatePlayerHealth(float HealthPercentage);
@@ -76,9 +78,18 @@ public:
     UFUNCTION(BlueprintCallable, Category = "UI")
     void UpdateCombatState(bool bInCombat);
 
+    UFUNCTION(BlueprintCallable, Category = "UI")
+    void UpdateStance(EStanceType NewStance);
+
+    // The HUD reads player state from here; the Update/Show/Hide functions above write to it
+    const FTrinityFlowHUDViewModel& GetHUDViewModel() const { return HUDViewModel; }
+
     UFUNCTION()
     void OnDamageDealt(AActor* DamagedActor, float ActualDamage, AActor* DamageInstigator, EDamageType DamageType);
 
+    // Subscribes damage numbers to the world's combat event bus (called when gameplay starts in a world)
+    void BindCombatEvents(UWorld* World);
+
     // Enemy Registry
     void RegisterEnemy(AEnemyBase* Enemy);
     void UnregisterEnemy(AEnemyBase* Enemy);
@@ -137,9 +148,18 @@ protected:
     // Viewport slot for current widget
     TSharedPtr<class SWeakWidget> CurrentWidgetContainer;
 
+    // Player state shown by the HUD
+    FTrinityFlowHUDViewModel HUDViewModel;
+
     // Enemy Registry
     TArray<AEnemyBase*> RegisteredEnemies;
     
+    // Combat event bus subscription
+    TWeakObjectPtr<UWorld> BoundEventWorld;
+    FDelegateHandle DamageEventHandle;
+
+    void OnDamageEvents(TArrayView<const FCombatEvent> Events);
+    
     // Active Altar
     UPROPERTY()
     class AShardAltar* ActiveAltar = nullptr;
@@ -13,6 +13,7 @@ class AActor;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnAltarActivated, int32, SoulShardsActivated, int32, PowerShardsActivated, AActor*, Activator);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAltarInteractionStarted, AActor*, Interactor);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAltarInteractionEnded);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnAltarActivationEndedNative, bool /*bCompleted*/);
 
 UENUM(BlueprintType)
 enum class EAltarPuzzleType : uint8
@@ -80,6 +81,9 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnAltarInteractionEnded OnAltarInteractionEnded;
 
+    // Native listeners (the altar UI) learn when an activation completes or is cancelled
+    FOnAltarActivationEndedNative OnActivationEndedNative;
+
     // Interaction Interface
     UFUNCTION(BlueprintCallable, Category = "Altar")
     bool CanActivate(AActor* Interactor) const;
@@ -16,6 +16,10 @@
 #include "Core/AnimationComponent.h"
 #include "Core/StanceComponent.h"
 #include "Core/ShardComponent.h"
+#include "Core/CombatantHandleSubsystem.h"
+#include "Core/TrinityFlowLog.h"
+#include "Core/CombatReplaySubsystem.h"
+#include "Core/CombatResolutionSubsystem.h"
 #include "Core/TrinityFlowStatsSubsystem.h"
 #include "Data/TrinityFlowCharacterStats.h"
 #include "Combat/AbilityComponent.h"
@@ -117,26 +121,35 @@ void ATrinityFlowCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInp
 	// Set up action bindings
 	if (UEnhancedInputComponent* EnhancedInputComponent = Cast<UEnhancedInputComponent>(PlayerInputComponent)) {
 		
+		// Gameplay actions go through the replay layer so they can be recorded and fed back
+		auto BindReplayable = [this, EnhancedInputComponent](const UInputAction* Action, ETriggerEvent TriggerEvent, EReplayInputAction ReplayAction)
+		{
+			EnhancedInputComponent->BindActionValueLambda(Action, TriggerEvent, [this, ReplayAction](const FInputActionValue& Value)
+			{
+				HandleReplayableInput(ReplayAction, Value.Get<FVector2D>());
+			});
+		};
+
 		// Moving
-		EnhancedInputComponent->BindAction(MoveAction, ETriggerEvent::Triggered, this, &ATrinityFlowCharacter::Move);
+		BindReplayable(MoveAction, ETriggerEvent::Triggered, EReplayInputAction::Move);
 
 		// Looking
-		EnhancedInputComponent->BindAction(LookAction, ETriggerEvent::Triggered, this, &ATrinityFlowCharacter::Look);
+		BindReplayable(LookAction, ETriggerEvent::Triggered, EReplayInputAction::Look);
 
 		// Combat - Dual Katana attacks
-		EnhancedInputComponent->BindAction(AttackAction, ETriggerEvent::Started, this, &ATrinityFlowCharacter::LeftKatanaAttack);     // LMB - Soul damage
-		EnhancedInputComponent->BindAction(RightAttackAction, ETriggerEvent::Started, this, &ATrinityFlowCharacter::RightKatanaAttack); // RMB - Physical damage
+		BindReplayable(AttackAction, ETriggerEvent::Started, EReplayInputAction::LeftAttack);       // LMB - Soul damage
+		BindReplayable(RightAttackAction, ETriggerEvent::Started, EReplayInputAction::RightAttack); // RMB - Physical damage
 
 		// Abilities
-		EnhancedInputComponent->BindAction(AbilityQAction, ETriggerEvent::Started, this, &ATrinityFlowCharacter::AbilityQ);       // Q - Code Break
-		EnhancedInputComponent->BindAction(AbilityEAction, ETriggerEvent::Started, this, &ATrinityFlowCharacter::AbilityE);       // E - Right katana ability / Interaction
-		EnhancedInputComponent->BindAction(AbilityTabAction, ETriggerEvent::Started, this, &ATrinityFlowCharacter::AbilityTab);   // Tab - Echoes of Data
-		EnhancedInputComponent->BindAction(AbilityRAction, ETriggerEvent::Started, this, &ATrinityFlowCharacter::AbilityR);       // R - Right katana ability 2
+		BindReplayable(AbilityQAction, ETriggerEvent::Started, EReplayInputAction::AbilityQ);       // Q - Code Break
+		BindReplayable(AbilityEAction, ETriggerEvent::Started, EReplayInputAction::AbilityE);       // E - Right katana ability / Interaction
+		BindReplayable(AbilityTabAction, ETriggerEvent::Started, EReplayInputAction::AbilityTab);   // Tab - Echoes of Data
+		BindReplayable(AbilityRAction, ETriggerEvent::Started, EReplayInputAction::AbilityR);       // R - Right katana ability 2
 
 		// Defensive abilities
-		EnhancedInputComponent->BindAction(LeftDefensiveAction, ETriggerEvent::Started, this, &ATrinityFlowCharacter::LeftDefensiveAbility);   // Shift - Scripted Dodge
-		EnhancedInputComponent->BindAction(RightDefensiveAction, ETriggerEvent::Started, this, &ATrinityFlowCharacter::RightDefensiveAbility); // Space - Order / Jump
-		EnhancedInputComponent->BindAction(RightDefensiveAction, ETriggerEvent::Completed, this, &ACharacter::StopJumping);
+		BindReplayable(LeftDefensiveAction, ETriggerEvent::Started, EReplayInputAction::LeftDefensive);   // Shift - Scripted Dodge
+		BindReplayable(RightDefensiveAction, ETriggerEvent::Started, EReplayInputAction::RightDefensive); // Space - Order / Jump
+		BindReplayable(RightDefensiveAction, ETriggerEvent::Completed, EReplayInputAction::StopJumping);
 
 		// UI
 		EnhancedInputComponent->BindAction(PauseGameAction, ETriggerEvent::Started, this, &ATrinityFlowCharacter::PauseGame); // Escape - Pause menu
@@ -147,6 +160,39 @@ void ATrinityFlowCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInp
 	}
 }
 
+void ATrinityFlowCharacter::HandleReplayableInput(EReplayInputAction Action, FVector2D Value)
+{
+	if (UCombatReplaySubsystem* Replay = UCombatReplaySubsystem::Get(this))
+	{
+		if (Replay->IsReplaying())
+		{
+			return;
+		}
+		Replay->RecordInput(Action, Value);
+	}
+
+	DispatchInput(Action, Value);
+}
+
+void ATrinityFlowCharacter::DispatchInput(EReplayInputAction Action, FVector2D Value)
+{
+	switch (Action)
+	{
+	case EReplayInputAction::Move:           Move(FInputActionValue(Value)); break;
+	case EReplayInputAction::Look:           Look(FInputActionValue(Value)); break;
+	case EReplayInputAction::LeftAttack:     LeftKatanaAttack(); break;
+	case EReplayInputAction::RightAttack:    RightKatanaAttack(); break;
+	case EReplayInputAction::AbilityQ:       AbilityQ(); break;
+	case EReplayInputAction::AbilityE:       AbilityE(); break;
+	case EReplayInputAction::AbilityTab:     AbilityTab(); break;
+	case EReplayInputAction::AbilityR:       AbilityR(); break;
+	case EReplayInputAction::LeftDefensive:  LeftDefensiveAbility(); break;
+	case EReplayInputAction::RightDefensive: RightDefensiveAbility(); break;
+	case EReplayInputAction::StopJumping:    StopJumping(); break;
+	default: break;
+	}
+}
+
 void ATrinityFlowCharacter::GlobalDefensiveAbility()
 {
 	// Check if UI is blocking input
@@ -295,6 +341,18 @@ void ATrinityFlowCharacter::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// Resolve combat component handles once for hit paths
+	if (UCombatantHandleSubsystem* Handles = GetWorld()->GetSubsystem<UCombatantHandleSubsystem>())
+	{
+		Handles->Register(this);
+	}
+
+	// Replays feed recorded input straight into the handlers
+	if (UCombatReplaySubsystem* Replay = UCombatReplaySubsystem::Get(this))
+	{
+		Replay->SetInputSink(FOnReplayInput::CreateUObject(this, &ATrinityFlowCharacter::DispatchInput));
+	}
+
 	// Load player stats from subsystem
 	UTrinityFlowCharacterStats* PlayerStats = nullptr;
 	
@@ -344,11 +402,25 @@ void ATrinityFlowCharacter::BeginPlay()
 	// Spawn weapons
 	SpawnWeapons();
 	
-	// Register player's own health component for echo system (in case of self-damage or special abilities)
+	// Echo system listens to every damage event in the world through the combat event bus
+	if (FCombatEventBus* EventBus = UCombatResolutionSubsystem::GetEventBus(this))
+	{
+		EventBus->Subscribe(ECombatEventType::DamageDealt, FOnCombatEvent::FDelegate::CreateWeakLambda(this, [this](const FCombatEvent& Event)
+		{
+			OnAnyDamageDealt(Event.Target, Event.Amount, Event.Instigator, Event.DamageType);
+		}));
+	}
+
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		if (UTrinityFlowUIManager* UIManager = GameInstance->GetSubsystem<UTrinityFlowUIManager>())
+		{
+			UIManager->BindCombatEvents(GetWorld());
+		}
+	}
+	
 	if (HealthComponent)
 	{
-		HealthComponent->OnDamageDealt.AddDynamic(this, &ATrinityFlowCharacter::OnAnyDamageDealt);
-		
 		// Subscribe to health changes to update UI
 		HealthComponent->OnHealthChanged.AddDynamic(this, &ATrinityFlowCharacter::OnHealthChanged);
 		
@@ -375,6 +447,23 @@ void ATrinityFlowCharacter::BeginPlay()
 			StateComponent->OnStateChanged.AddDynamic(this, &ATrinityFlowCharacter::OnStateChanged);
 		}
 	}
+
+	// The HUD view-model is pushed from these events rather than polled
+	if (StanceComponent)
+	{
+		StanceComponent->OnStanceChanged.AddDynamic(this, &ATrinityFlowCharacter::OnStanceChanged);
+		OnStanceChanged(StanceComponent->GetCurrentStance());
+	}
+
+	if (ShardComponent)
+	{
+		ShardComponent->OnShardCollected.AddDynamic(this, &ATrinityFlowCharacter::OnShardCollected);
+		ShardComponent->OnShardsActivated.AddDynamic(this, &ATrinityFlowCharacter::OnShardsActivated);
+		ShardComponent->OnDamageBonusChanged.AddDynamic(this, &ATrinityFlowCharacter::OnDamageBonusChanged);
+	}
+
+	UpdatePlayerStatsUI();
+	UpdateCombatStateUI();
 }
 
 void ATrinityFlowCharacter::Tick(float DeltaTime)
@@ -476,6 +565,7 @@ void ATrinityFlowCharacter::LeftKatanaAttack()
 	{
 		StanceComponent->OnAttackExecuted(true); // true = left attack
 	}
+	UpdateCombatStateUI();
 	
 	// Set timer to reset attack state
 	GetWorld()->GetTimerManager().SetTimer(AttackResetTimer, this, &ATrinityFlowCharacter::OnAttackComplete, MontageLength, false);
@@ -543,6 +633,7 @@ void ATrinityFlowCharacter::RightKatanaAttack()
 	{
 		StanceComponent->OnAttackExecuted(false); // false = right attack
 	}
+	UpdateCombatStateUI();
 	
 	// Set timer to reset attack state
 	GetWorld()->GetTimerManager().SetTimer(AttackResetTimer, this, &ATrinityFlowCharacter::OnAttackComplete, MontageLength, false);
@@ -855,7 +946,7 @@ void ATrinityFlowCharacter::RightDefensiveAbility()
 				// If perfect defense, trigger enemy parry response animation
 				if (bIsPerfect && PendingAttacker)
 				{
-					if (UEnemyAnimationComponent* EnemyAnimComp = PendingAttacker->FindComponentByClass<UEnemyAnimationComponent>())
+					if (UEnemyAnimationComponent* EnemyAnimComp = UCombatantHandleSubsystem::Get(PendingAttacker).EnemyAnimation.Get())
 					{
 						EnemyAnimComp->PlayParryResponse();
 					}
@@ -1041,7 +1132,7 @@ void ATrinityFlowCharacter::EndDefensiveAbility()
 
 void ATrinityFlowCharacter::OnAnyDamageDealt(AActor* DamagedActor, float ActualDamage, AActor* DamageInstigator, EDamageType DamageType)
 {
-	UE_LOG(LogTemp, Warning, TEXT("OnAnyDamageDealt: DamagedActor=%s, Damage=%.1f, Instigator=%s"), 
+	UE_LOG(LogTrinityFlowCombat, VeryVerbose, TEXT("OnAnyDamageDealt: DamagedActor=%s, Damage=%.1f, Instigator=%s"), 
 		DamagedActor ? *DamagedActor->GetName() : TEXT("NULL"),
 		ActualDamage,
 		DamageInstigator ? *DamageInstigator->GetName() : TEXT("NULL"));
@@ -1054,23 +1145,11 @@ void ATrinityFlowCharacter::OnAnyDamageDealt(AActor* DamagedActor, float ActualD
 	
 	if (bIsPlayerDamage && AbilityComponent && DamagedActor)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Forwarding to AbilityComponent for echo processing"));
+		UE_LOG(LogTrinityFlowCombat, VeryVerbose, TEXT("Forwarding to AbilityComponent for echo processing"));
 		AbilityComponent->OnActualDamageDealt(DamagedActor, ActualDamage, this, DamageType);
 	}
 }
 
-void ATrinityFlowCharacter::RegisterEnemyDamageEvents(AEnemyBase* Enemy)
-{
-	if (Enemy)
-	{
-		if (UHealthComponent* HealthComp = Enemy->FindComponentByClass<UHealthComponent>())
-		{
-			HealthComp->OnDamageDealt.AddDynamic(this, &ATrinityFlowCharacter::OnAnyDamageDealt);
-			UE_LOG(LogTemp, Warning, TEXT("Registered damage events for enemy: %s"), *Enemy->GetName());
-		}
-	}
-}
-
 AActor* ATrinityFlowCharacter::GetTargetInSight()
 {
 	AController* CurrentController = GetController();
@@ -1115,6 +1194,34 @@ void ATrinityFlowCharacter::OnStateChanged(ECharacterState NewState)
 		
 		UE_LOG(LogTemplateCharacter, Log, TEXT("Combat state changed: %s"), bInCombat ? TEXT("In Combat") : TEXT("Out of Combat"));
 	}
+
+	UpdateCombatStateUI();
+}
+
+void ATrinityFlowCharacter::OnStanceChanged(EStanceType NewStance)
+{
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		if (UTrinityFlowUIManager* UIManager = GameInstance->GetSubsystem<UTrinityFlowUIManager>())
+		{
+			UIManager->UpdateStance(NewStance);
+		}
+	}
+}
+
+void ATrinityFlowCharacter::OnShardCollected(EShardType ShardType, int32 NewInactiveCount)
+{
+	UpdatePlayerStatsUI();
+}
+
+void ATrinityFlowCharacter::OnShardsActivated(EShardType ShardType, int32 ActivatedCount, int32 NewActiveCount)
+{
+	UpdatePlayerStatsUI();
+}
+
+void ATrinityFlowCharacter::OnDamageBonusChanged(float SoulBonus, float PhysicalBonus, float SoulStanceBonus, float PhysicalStanceBonus)
+{
+	UpdatePlayerStatsUI();
 }
 
 void ATrinityFlowCharacter::OnHealthChanged(float NewHealth)
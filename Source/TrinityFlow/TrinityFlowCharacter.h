@@ -13,6 +13,7 @@ class UCameraComponent;
 class UInputMappingContext;
 class UInputAction;
 struct FInputActionValue;
+enum class EReplayInputAction : uint8;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogTemplateCharacter, Log, All);
 
@@ -134,9 +135,6 @@ public:
 	
 	UFUNCTION()
 	void OnAnyDamageDealt(AActor* DamagedActor, float ActualDamage, AActor* DamageInstigator, EDamageType DamageType);
-	
-	UFUNCTION()
-	void RegisterEnemyDamageEvents(class AEnemyBase* Enemy);
 
 	UFUNCTION()
 	void OnStateChanged(ECharacterState NewState);
@@ -144,6 +142,18 @@ public:
 	UFUNCTION()
 	void OnHealthChanged(float NewHealth);
 
+	UFUNCTION()
+	void OnStanceChanged(EStanceType NewStance);
+
+	UFUNCTION()
+	void OnShardCollected(EShardType ShardType, int32 NewInactiveCount);
+
+	UFUNCTION()
+	void OnShardsActivated(EShardType ShardType, int32 ActivatedCount, int32 NewActiveCount);
+
+	UFUNCTION()
+	void OnDamageBonusChanged(float SoulBonus, float PhysicalBonus, float SoulStanceBonus, float PhysicalStanceBonus);
+
 	/** Called when attack completes */
 	UFUNCTION()
 	void OnAttackComplete();
@@ -175,6 +185,12 @@ protected:
 	void GlobalDefensiveAbility(); // X - Stance-based defensive
 	void PauseGame();  // Escape - Pause menu
 
+	/** Records live input for combat replays, or drops it while a replay is driving the character */
+	void HandleReplayableInput(EReplayInputAction Action, FVector2D Value);
+
+	/** Runs the handler for a live or replayed input */
+	void DispatchInput(EReplayInputAction Action, FVector2D Value);
+
 	/** Components */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	class UHealthComponent* HealthComponent;